@@ -9,6 +9,7 @@
 #include "../core/error_codes.h"
 #include "../utils/logger.h"
 #include <oqs/oqs.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -28,6 +29,8 @@ typedef struct {
 typedef struct {
     OQS_KEM *kem;      // Non-NULL for KEM algorithms
     OQS_SIG *sig;      // Non-NULL for signature algorithms
+    char name[32];     // Owned copy of the algorithm name (backs alg->name)
+    int refcount;      // Shared-handle reference count (guarded by cache mutex)
 } liboqs_alg_context_t;
 
 // ============================================================================
@@ -44,6 +47,60 @@ static const char* SUPPORTED_ALGORITHMS[] = {
     NULL  // Sentinel
 };
 
+// ============================================================================
+// Algorithm Handle Cache
+// ============================================================================
+
+// One slot per supported algorithm. The first create call for a name
+// instantiates the OQS object; later calls return the same immutable
+// handle with an incremented refcount. liboqs_destroy_algorithm() only
+// tears the handle down when the last reference is released, so the
+// parallel scheduler's workers all share one OQS init per algorithm.
+
+#define LIBOQS_CACHE_SLOTS 8
+
+static PQCAlgorithm *g_alg_cache[LIBOQS_CACHE_SLOTS];
+static pthread_mutex_t g_alg_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Look up a cached handle by name (cache mutex must be held)
+ * @return Cached handle, or NULL if not present
+ */
+static PQCAlgorithm* cache_lookup(const char *name) {
+    for (int i = 0; i < LIBOQS_CACHE_SLOTS; i++) {
+        if (g_alg_cache[i] && strcmp(g_alg_cache[i]->name, name) == 0) {
+            return g_alg_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Insert a handle into the cache (cache mutex must be held)
+ * @return PQC_SUCCESS, or PQC_ERROR_MEMORY_ALLOC if all slots are taken
+ */
+static int cache_insert(PQCAlgorithm *alg) {
+    for (int i = 0; i < LIBOQS_CACHE_SLOTS; i++) {
+        if (!g_alg_cache[i]) {
+            g_alg_cache[i] = alg;
+            return PQC_SUCCESS;
+        }
+    }
+    return PQC_ERROR_MEMORY_ALLOC;
+}
+
+/**
+ * @brief Remove a handle from the cache (cache mutex must be held)
+ */
+static void cache_remove(PQCAlgorithm *alg) {
+    for (int i = 0; i < LIBOQS_CACHE_SLOTS; i++) {
+        if (g_alg_cache[i] == alg) {
+            g_alg_cache[i] = NULL;
+            return;
+        }
+    }
+}
+
 // ============================================================================
 // Algorithm Name Mapping
 // ============================================================================
@@ -237,15 +294,13 @@ static void liboqs_algorithm_cleanup(PQCAlgorithm *alg) {
 }
 
 // ============================================================================
-// Helper Functions Implementation
+// Handle Construction (uncached)
 // ============================================================================
 
-PQCAlgorithm* liboqs_create_kem_algorithm(const char *name) {
-    if (!name) {
-        LOG_ERROR("Algorithm name is NULL");
-        return NULL;
-    }
-    
+/**
+ * @brief Instantiate a fresh KEM handle (no cache interaction)
+ */
+static PQCAlgorithm* create_kem_handle(const char *name) {
     const char *oqs_name = map_algorithm_name(name);
     if (!oqs_name) {
         LOG_ERROR("Unknown algorithm: %s", name);
@@ -284,13 +339,16 @@ PQCAlgorithm* liboqs_create_kem_algorithm(const char *name) {
     
     ctx->kem = kem;
     ctx->sig = NULL;
-    
-    // Extract variant from name (e.g., "mlkem512" -> "512")
-    const char *variant = name + 5;  // Skip "mlkem"
-    
+    ctx->refcount = 1;
+
+    // Own a copy of the name: the shared handle may outlive the caller's string
+    strncpy(ctx->name, name, sizeof(ctx->name) - 1);
+    ctx->name[sizeof(ctx->name) - 1] = '\0';
+
     // Fill in algorithm structure
-    alg->name = name;
-    alg->variant = variant;
+    alg->name = ctx->name;
+    alg->variant = ctx->name + 5;  // Skip "mlkem" (e.g., "mlkem512" -> "512")
+    alg->provider = "liboqs";
     alg->type = PQC_ALG_TYPE_KEM;
     alg->keygen = liboqs_kem_keygen;
     alg->encaps = liboqs_kem_encaps;
@@ -311,12 +369,10 @@ PQCAlgorithm* liboqs_create_kem_algorithm(const char *name) {
     return alg;
 }
 
-PQCAlgorithm* liboqs_create_sig_algorithm(const char *name) {
-    if (!name) {
-        LOG_ERROR("Algorithm name is NULL");
-        return NULL;
-    }
-    
+/**
+ * @brief Instantiate a fresh signature handle (no cache interaction)
+ */
+static PQCAlgorithm* create_sig_handle(const char *name) {
     const char *oqs_name = map_algorithm_name(name);
     if (!oqs_name) {
         LOG_ERROR("Unknown algorithm: %s", name);
@@ -355,13 +411,16 @@ PQCAlgorithm* liboqs_create_sig_algorithm(const char *name) {
     
     ctx->kem = NULL;
     ctx->sig = sig;
-    
-    // Extract variant from name (e.g., "mldsa44" -> "44")
-    const char *variant = name + 5;  // Skip "mldsa"
-    
+    ctx->refcount = 1;
+
+    // Own a copy of the name: the shared handle may outlive the caller's string
+    strncpy(ctx->name, name, sizeof(ctx->name) - 1);
+    ctx->name[sizeof(ctx->name) - 1] = '\0';
+
     // Fill in algorithm structure
-    alg->name = name;
-    alg->variant = variant;
+    alg->name = ctx->name;
+    alg->variant = ctx->name + 5;  // Skip "mldsa" (e.g., "mldsa44" -> "44")
+    alg->provider = "liboqs";
     alg->type = PQC_ALG_TYPE_SIGNATURE;
     alg->keygen = liboqs_sig_keygen;
     alg->encaps = NULL;
@@ -378,12 +437,78 @@ PQCAlgorithm* liboqs_create_sig_algorithm(const char *name) {
     
     LOG_DEBUG("Created signature algorithm: %s (pk=%zu, sk=%zu, sig=%zu)",
               name, alg->pk_len, alg->sk_len, alg->sig_len);
-    
+
     return alg;
 }
 
+// ============================================================================
+// Helper Functions Implementation
+// ============================================================================
+
+/**
+ * @brief Return the shared handle for @p name, instantiating on first use
+ * @param name Algorithm name (already validated as non-NULL)
+ * @param create Uncached constructor (create_kem_handle or create_sig_handle)
+ */
+static PQCAlgorithm* cache_acquire(const char *name,
+                                   PQCAlgorithm* (*create)(const char*)) {
+    pthread_mutex_lock(&g_alg_cache_mutex);
+
+    PQCAlgorithm *alg = cache_lookup(name);
+    if (alg) {
+        liboqs_alg_context_t *ctx = (liboqs_alg_context_t*)alg->context;
+        ctx->refcount++;
+        pthread_mutex_unlock(&g_alg_cache_mutex);
+        LOG_DEBUG("Reusing cached handle for %s (refcount=%d)",
+                  name, ctx->refcount);
+        return alg;
+    }
+
+    alg = create(name);
+    if (alg && cache_insert(alg) != PQC_SUCCESS) {
+        // Should not happen with LIBOQS_CACHE_SLOTS >= supported algorithms;
+        // hand out an uncached handle rather than failing the benchmark
+        LOG_WARN("Algorithm handle cache is full; %s will not be shared", name);
+    }
+
+    pthread_mutex_unlock(&g_alg_cache_mutex);
+    return alg;
+}
+
+PQCAlgorithm* liboqs_create_kem_algorithm(const char *name) {
+    if (!name) {
+        LOG_ERROR("Algorithm name is NULL");
+        return NULL;
+    }
+
+    return cache_acquire(name, create_kem_handle);
+}
+
+PQCAlgorithm* liboqs_create_sig_algorithm(const char *name) {
+    if (!name) {
+        LOG_ERROR("Algorithm name is NULL");
+        return NULL;
+    }
+
+    return cache_acquire(name, create_sig_handle);
+}
+
 void liboqs_destroy_algorithm(PQCAlgorithm *alg) {
-    if (alg && alg->cleanup) {
+    if (!alg) return;
+
+    pthread_mutex_lock(&g_alg_cache_mutex);
+
+    liboqs_alg_context_t *ctx = (liboqs_alg_context_t*)alg->context;
+    if (ctx && --ctx->refcount > 0) {
+        // Other holders remain; keep the shared handle alive
+        pthread_mutex_unlock(&g_alg_cache_mutex);
+        return;
+    }
+
+    cache_remove(alg);
+    pthread_mutex_unlock(&g_alg_cache_mutex);
+
+    if (alg->cleanup) {
         alg->cleanup(alg);
     }
 }
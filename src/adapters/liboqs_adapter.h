@@ -46,7 +46,12 @@ void destroy_liboqs_provider(PQCProvider *provider);
  * @brief Create a KEM algorithm instance
  * @param name Algorithm name (e.g., "mlkem512", "mlkem768", "mlkem1024")
  * @return Pointer to PQCAlgorithm, or NULL on failure
- * 
+ *
+ * Handles are cached per algorithm name: the first call instantiates the
+ * underlying OQS object, later calls return the same immutable handle with
+ * its reference count incremented. Each successful call must be balanced by
+ * one liboqs_destroy_algorithm().
+ *
  * Supported algorithms:
  * - mlkem512 (ML-KEM-512)
  * - mlkem768 (ML-KEM-768)
@@ -58,7 +63,9 @@ PQCAlgorithm* liboqs_create_kem_algorithm(const char *name);
  * @brief Create a signature algorithm instance
  * @param name Algorithm name (e.g., "mldsa44", "mldsa65", "mldsa87")
  * @return Pointer to PQCAlgorithm, or NULL on failure
- * 
+ *
+ * Handles are cached per algorithm name; see liboqs_create_kem_algorithm().
+ *
  * Supported algorithms:
  * - mldsa44 (ML-DSA-44)
  * - mldsa65 (ML-DSA-65)
@@ -67,8 +74,11 @@ PQCAlgorithm* liboqs_create_kem_algorithm(const char *name);
 PQCAlgorithm* liboqs_create_sig_algorithm(const char *name);
 
 /**
- * @brief Destroy an algorithm instance created by liboqs adapter
- * @param alg Algorithm to destroy
+ * @brief Release an algorithm handle obtained from the liboqs adapter
+ * @param alg Algorithm to release
+ *
+ * Decrements the handle's reference count; the OQS object and wrapper are
+ * freed only when the last reference is released.
  */
 void liboqs_destroy_algorithm(PQCAlgorithm *alg);
 
@@ -0,0 +1,180 @@
+/**
+ * @file liboqs_direct.c
+ * @brief Monomorphized liboqs measurement kernels implementation
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Each kernel is one macro expansion: timestamp, a batch of direct calls
+ * to the per-algorithm OQS entry point, timestamp. The compiler sees the
+ * concrete callee, so the measured window carries no function-pointer
+ * dispatch and no adapter trampoline. Kernels are compiled only for the
+ * variants the liboqs build enables (OQS_ENABLE_* from oqsconfig.h).
+ */
+
+#include <oqs/oqs.h>
+
+#include "liboqs_direct.h"
+#include "../core/benchmark_engine.h"
+#include "../core/error_codes.h"
+#include "../utils/timing.h"
+#include "../utils/logger.h"
+
+// ============================================================================
+// Kernel Templates
+// ============================================================================
+
+/// KEM kernels: keygen, encaps, decaps against the direct OQS symbols
+#define PQC_DEFINE_KEM_KERNELS(id, OQSID)                                     \
+static int direct_##id##_keygen(pqc_direct_buffers_t *b, int batch,           \
+                                uint64_t *elapsed_ns) {                       \
+    pqc_timestamp_t start = pqc_timestamp_now();                              \
+    for (int i = 0; i < batch; i++) {                                         \
+        if (OQS_KEM_##OQSID##_keypair(b->pk, b->sk) != OQS_SUCCESS) {         \
+            return PQC_ERROR_OPERATION_FAILED;                                \
+        }                                                                     \
+    }                                                                         \
+    pqc_timestamp_t end = pqc_timestamp_now();                                \
+    *elapsed_ns = pqc_timestamp_diff(start, end);                             \
+    return PQC_SUCCESS;                                                       \
+}                                                                             \
+static int direct_##id##_encaps(pqc_direct_buffers_t *b, int batch,           \
+                                uint64_t *elapsed_ns) {                       \
+    pqc_timestamp_t start = pqc_timestamp_now();                              \
+    for (int i = 0; i < batch; i++) {                                         \
+        if (OQS_KEM_##OQSID##_encaps(b->ct, b->ss, b->pk) != OQS_SUCCESS) {   \
+            return PQC_ERROR_OPERATION_FAILED;                                \
+        }                                                                     \
+    }                                                                         \
+    pqc_timestamp_t end = pqc_timestamp_now();                                \
+    *elapsed_ns = pqc_timestamp_diff(start, end);                             \
+    return PQC_SUCCESS;                                                       \
+}                                                                             \
+static int direct_##id##_decaps(pqc_direct_buffers_t *b, int batch,           \
+                                uint64_t *elapsed_ns) {                       \
+    pqc_timestamp_t start = pqc_timestamp_now();                              \
+    for (int i = 0; i < batch; i++) {                                         \
+        if (OQS_KEM_##OQSID##_decaps(b->ss_dec, b->ct,                        \
+                                     b->sk) != OQS_SUCCESS) {                 \
+            return PQC_ERROR_OPERATION_FAILED;                                \
+        }                                                                     \
+    }                                                                         \
+    pqc_timestamp_t end = pqc_timestamp_now();                                \
+    *elapsed_ns = pqc_timestamp_diff(start, end);                             \
+    return PQC_SUCCESS;                                                       \
+}
+
+/// Signature kernels: keygen, sign, verify against the direct OQS symbols
+#define PQC_DEFINE_SIG_KERNELS(id, OQSID)                                     \
+static int direct_##id##_keygen(pqc_direct_buffers_t *b, int batch,           \
+                                uint64_t *elapsed_ns) {                       \
+    pqc_timestamp_t start = pqc_timestamp_now();                              \
+    for (int i = 0; i < batch; i++) {                                         \
+        if (OQS_SIG_##OQSID##_keypair(b->pk, b->sk) != OQS_SUCCESS) {         \
+            return PQC_ERROR_OPERATION_FAILED;                                \
+        }                                                                     \
+    }                                                                         \
+    pqc_timestamp_t end = pqc_timestamp_now();                                \
+    *elapsed_ns = pqc_timestamp_diff(start, end);                             \
+    return PQC_SUCCESS;                                                       \
+}                                                                             \
+static int direct_##id##_sign(pqc_direct_buffers_t *b, int batch,             \
+                              uint64_t *elapsed_ns) {                         \
+    pqc_timestamp_t start = pqc_timestamp_now();                              \
+    for (int i = 0; i < batch; i++) {                                         \
+        size_t sig_len = b->sig_cap;                                          \
+        if (OQS_SIG_##OQSID##_sign(b->sig, &sig_len, b->msg, b->msg_len,      \
+                                   b->sk) != OQS_SUCCESS) {                   \
+            return PQC_ERROR_OPERATION_FAILED;                                \
+        }                                                                     \
+    }                                                                         \
+    pqc_timestamp_t end = pqc_timestamp_now();                                \
+    *elapsed_ns = pqc_timestamp_diff(start, end);                             \
+    return PQC_SUCCESS;                                                       \
+}                                                                             \
+static int direct_##id##_verify(pqc_direct_buffers_t *b, int batch,           \
+                                uint64_t *elapsed_ns) {                       \
+    pqc_timestamp_t start = pqc_timestamp_now();                              \
+    for (int i = 0; i < batch; i++) {                                         \
+        if (OQS_SIG_##OQSID##_verify(b->msg, b->msg_len, b->sig,              \
+                                     b->sig_actual_len,                       \
+                                     b->pk) != OQS_SUCCESS) {                 \
+            return PQC_ERROR_OPERATION_FAILED;                                \
+        }                                                                     \
+    }                                                                         \
+    pqc_timestamp_t end = pqc_timestamp_now();                                \
+    *elapsed_ns = pqc_timestamp_diff(start, end);                             \
+    return PQC_SUCCESS;                                                       \
+}
+
+#ifdef OQS_ENABLE_KEM_ml_kem_512
+PQC_DEFINE_KEM_KERNELS(mlkem512, ml_kem_512)
+#endif
+#ifdef OQS_ENABLE_KEM_ml_kem_768
+PQC_DEFINE_KEM_KERNELS(mlkem768, ml_kem_768)
+#endif
+#ifdef OQS_ENABLE_KEM_ml_kem_1024
+PQC_DEFINE_KEM_KERNELS(mlkem1024, ml_kem_1024)
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_44
+PQC_DEFINE_SIG_KERNELS(mldsa44, ml_dsa_44)
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_65
+PQC_DEFINE_SIG_KERNELS(mldsa65, ml_dsa_65)
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_87
+PQC_DEFINE_SIG_KERNELS(mldsa87, ml_dsa_87)
+#endif
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+#define PQC_REGISTER_KEM_KERNELS(name, id)                                    \
+    do {                                                                      \
+        if (pqc_benchmark_register_direct_loop(name, "keygen",                \
+                direct_##id##_keygen) == PQC_SUCCESS) registered++;           \
+        if (pqc_benchmark_register_direct_loop(name, "encaps",                \
+                direct_##id##_encaps) == PQC_SUCCESS) registered++;           \
+        if (pqc_benchmark_register_direct_loop(name, "decaps",               \
+                direct_##id##_decaps) == PQC_SUCCESS) registered++;           \
+    } while (0)
+
+#define PQC_REGISTER_SIG_KERNELS(name, id)                                    \
+    do {                                                                      \
+        if (pqc_benchmark_register_direct_loop(name, "keygen",                \
+                direct_##id##_keygen) == PQC_SUCCESS) registered++;           \
+        if (pqc_benchmark_register_direct_loop(name, "sign",                  \
+                direct_##id##_sign) == PQC_SUCCESS) registered++;             \
+        if (pqc_benchmark_register_direct_loop(name, "verify",                \
+                direct_##id##_verify) == PQC_SUCCESS) registered++;           \
+    } while (0)
+
+int liboqs_register_direct_loops(void) {
+    static int registered = -1;
+    if (registered >= 0) {
+        return registered;
+    }
+    registered = 0;
+
+#ifdef OQS_ENABLE_KEM_ml_kem_512
+    PQC_REGISTER_KEM_KERNELS("mlkem512", mlkem512);
+#endif
+#ifdef OQS_ENABLE_KEM_ml_kem_768
+    PQC_REGISTER_KEM_KERNELS("mlkem768", mlkem768);
+#endif
+#ifdef OQS_ENABLE_KEM_ml_kem_1024
+    PQC_REGISTER_KEM_KERNELS("mlkem1024", mlkem1024);
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_44
+    PQC_REGISTER_SIG_KERNELS("mldsa44", mldsa44);
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_65
+    PQC_REGISTER_SIG_KERNELS("mldsa65", mldsa65);
+#endif
+#ifdef OQS_ENABLE_SIG_ml_dsa_87
+    PQC_REGISTER_SIG_KERNELS("mldsa87", mldsa87);
+#endif
+
+    LOG_DEBUG("Registered %d monomorphized liboqs kernels", registered);
+    return registered;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file liboqs_direct.h
+ * @brief Monomorphized liboqs measurement kernels
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * The generic measurement loop reaches liboqs through two indirect calls
+ * per sample: the engine's operation callback and the adapter's trampoline
+ * into OQS_KEM/OQS_SIG. For ~microsecond operations that dispatch is a
+ * measurable, branch-predictor-dependent bias that differs across
+ * architectures. This module registers compile-time specialized timed
+ * batches with the engine (see pqc_benchmark_register_direct_loop) that
+ * call the per-algorithm OQS entry points directly for the six known
+ * ML-KEM/ML-DSA variants; unrecognized algorithms keep the generic path.
+ */
+
+#ifndef LIBOQS_DIRECT_H
+#define LIBOQS_DIRECT_H
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+/**
+ * @brief Register direct kernels for every ML-KEM/ML-DSA variant liboqs
+ *        was built with
+ * @return Number of kernels registered
+ *
+ * Idempotent; the benchmark drivers call this once at startup, before any
+ * measurement runs. Binaries that never register keep the generic
+ * function-pointer path everywhere.
+ */
+int liboqs_register_direct_loops(void);
+
+#endif // LIBOQS_DIRECT_H
@@ -0,0 +1,658 @@
+/**
+ * @file openssl_adapter.c
+ * @brief OpenSSL adapter implementation
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#include "openssl_adapter.h"
+#include "../core/error_codes.h"
+#include "../utils/logger.h"
+#include <openssl/opensslv.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ML-KEM/ML-DSA landed in OpenSSL 3.5; older libraries compile a stub
+// adapter whose init fails cleanly at runtime
+#if OPENSSL_VERSION_NUMBER >= 0x30500000L
+#define OPENSSL_HAVE_PQC 1
+#include <openssl/evp.h>
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#define OPENSSL_HAVE_PQC 0
+#endif
+
+// ============================================================================
+// Internal Context Structure
+// ============================================================================
+
+typedef struct {
+    int initialized;
+} openssl_context_t;
+
+// ============================================================================
+// Supported Algorithms
+// ============================================================================
+
+/**
+ * @brief Per-algorithm metadata: EVP name and FIPS 203/204 buffer sizes
+ *
+ * The sizes are fixed by the standards; keygen cross-checks them against
+ * what OpenSSL actually exports so a mismatch fails loudly instead of
+ * corrupting adjacent arena blocks.
+ */
+typedef struct {
+    const char *name;        ///< Our algorithm name (e.g., "mlkem512")
+    const char *ossl_name;   ///< OpenSSL EVP algorithm name
+    int is_kem;              ///< 1 for KEM, 0 for signature
+    size_t pk_len;           ///< Public key length
+    size_t sk_len;           ///< Secret key length (expanded form)
+    size_t ct_len;           ///< Ciphertext length (KEM only)
+    size_t ss_len;           ///< Shared secret length (KEM only)
+    size_t sig_len;          ///< Signature length (signature only)
+} openssl_alg_info_t;
+
+static const openssl_alg_info_t ALG_TABLE[] = {
+    { "mlkem512",  "ML-KEM-512",  1,  800, 1632,  768, 32,    0 },
+    { "mlkem768",  "ML-KEM-768",  1, 1184, 2400, 1088, 32,    0 },
+    { "mlkem1024", "ML-KEM-1024", 1, 1568, 3168, 1568, 32,    0 },
+    { "mldsa44",   "ML-DSA-44",   0, 1312, 2560,    0,  0, 2420 },
+    { "mldsa65",   "ML-DSA-65",   0, 1952, 4032,    0,  0, 3309 },
+    { "mldsa87",   "ML-DSA-87",   0, 2592, 4896,    0,  0, 4627 },
+};
+
+#define ALG_TABLE_SIZE (sizeof(ALG_TABLE) / sizeof(ALG_TABLE[0]))
+
+// Same names, same order as the liboqs adapter, so runs are comparable
+static const char* SUPPORTED_ALGORITHMS[] = {
+    "mlkem512",
+    "mlkem768",
+    "mlkem1024",
+    "mldsa44",
+    "mldsa65",
+    "mldsa87",
+    NULL  // Sentinel
+};
+
+static const openssl_alg_info_t* find_alg_info(const char *name) {
+    for (size_t i = 0; i < ALG_TABLE_SIZE; i++) {
+        if (strcmp(ALG_TABLE[i].name, name) == 0) {
+            return &ALG_TABLE[i];
+        }
+    }
+    return NULL;
+}
+
+#if OPENSSL_HAVE_PQC
+
+// ============================================================================
+// Internal Algorithm Context
+// ============================================================================
+
+/**
+ * @brief Per-handle state, including the imported-key cache
+ *
+ * The engine passes raw key bytes to every operation but reuses the same
+ * buffer across iterations, so the adapter caches the EVP_PKEY imported
+ * from a given buffer pointer and only re-imports when the pointer
+ * changes or keygen produces fresh material. The mutex guards the cache,
+ * not the crypto operations, so parallel workers sharing a handle only
+ * contend on a pointer compare. Lookups hand each caller its own EVP_PKEY
+ * reference (taken under the lock), so an invalidation or replacement on
+ * another worker cannot free a key that is still in use.
+ */
+typedef struct {
+    char name[32];             // Owned copy of the algorithm name
+    const openssl_alg_info_t *info;
+    EVP_SIGNATURE *sig_alg;    // Fetched once (signature algorithms only)
+    pthread_mutex_t lock;      // Guards the imported-key cache
+    EVP_PKEY *pub_pkey;        // Cached import of the last public key
+    const uint8_t *pub_src;    // Buffer the cached public key came from
+    EVP_PKEY *priv_pkey;       // Cached import of the last secret key
+    const uint8_t *priv_src;   // Buffer the cached secret key came from
+} openssl_alg_context_t;
+
+// ============================================================================
+// Key Import Cache
+// ============================================================================
+
+/**
+ * @brief Import raw key bytes into an EVP_PKEY
+ */
+static EVP_PKEY* import_raw_key(const openssl_alg_context_t *ctx,
+                                int is_public,
+                                const uint8_t *raw, size_t raw_len) {
+    EVP_PKEY_CTX *pctx =
+        EVP_PKEY_CTX_new_from_name(NULL, ctx->info->ossl_name, NULL);
+    if (!pctx) {
+        LOG_ERROR("Failed to create EVP_PKEY_CTX for %s",
+                  ctx->info->ossl_name);
+        return NULL;
+    }
+
+    OSSL_PARAM params[2];
+    params[0] = OSSL_PARAM_construct_octet_string(
+        is_public ? OSSL_PKEY_PARAM_PUB_KEY : OSSL_PKEY_PARAM_PRIV_KEY,
+        (void*)raw, raw_len);
+    params[1] = OSSL_PARAM_construct_end();
+
+    EVP_PKEY *pkey = NULL;
+    if (EVP_PKEY_fromdata_init(pctx) <= 0 ||
+        EVP_PKEY_fromdata(pctx, &pkey,
+                          is_public ? EVP_PKEY_PUBLIC_KEY : EVP_PKEY_KEYPAIR,
+                          params) <= 0) {
+        LOG_ERROR("EVP_PKEY_fromdata failed for %s", ctx->info->ossl_name);
+        pkey = NULL;
+    }
+
+    EVP_PKEY_CTX_free(pctx);
+    return pkey;
+}
+
+/**
+ * @brief Drop cached imports (key material changed under the buffers)
+ */
+static void invalidate_key_cache(openssl_alg_context_t *ctx) {
+    pthread_mutex_lock(&ctx->lock);
+    EVP_PKEY_free(ctx->pub_pkey);
+    ctx->pub_pkey = NULL;
+    ctx->pub_src = NULL;
+    EVP_PKEY_free(ctx->priv_pkey);
+    ctx->priv_pkey = NULL;
+    ctx->priv_src = NULL;
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+/**
+ * @brief Get the EVP_PKEY for a public key buffer, importing on miss
+ *
+ * The returned key carries its own reference, taken under the lock, so a
+ * concurrent invalidation or cache replacement cannot free it while the
+ * caller is mid-operation. The caller must EVP_PKEY_free() it when done.
+ */
+static EVP_PKEY* cached_pub_key(openssl_alg_context_t *ctx,
+                                const uint8_t *pk) {
+    pthread_mutex_lock(&ctx->lock);
+    if (ctx->pub_src != pk) {
+        EVP_PKEY_free(ctx->pub_pkey);
+        ctx->pub_pkey = import_raw_key(ctx, 1, pk, ctx->info->pk_len);
+        ctx->pub_src = ctx->pub_pkey ? pk : NULL;
+    }
+    EVP_PKEY *pkey = ctx->pub_pkey;
+    if (pkey && EVP_PKEY_up_ref(pkey) <= 0) {
+        pkey = NULL;
+    }
+    pthread_mutex_unlock(&ctx->lock);
+    return pkey;
+}
+
+/**
+ * @brief Get the EVP_PKEY for a secret key buffer, importing on miss
+ *
+ * Same ownership contract as cached_pub_key(): the caller holds a
+ * reference and must EVP_PKEY_free() it.
+ */
+static EVP_PKEY* cached_priv_key(openssl_alg_context_t *ctx,
+                                 const uint8_t *sk) {
+    pthread_mutex_lock(&ctx->lock);
+    if (ctx->priv_src != sk) {
+        EVP_PKEY_free(ctx->priv_pkey);
+        ctx->priv_pkey = import_raw_key(ctx, 0, sk, ctx->info->sk_len);
+        ctx->priv_src = ctx->priv_pkey ? sk : NULL;
+    }
+    EVP_PKEY *pkey = ctx->priv_pkey;
+    if (pkey && EVP_PKEY_up_ref(pkey) <= 0) {
+        pkey = NULL;
+    }
+    pthread_mutex_unlock(&ctx->lock);
+    return pkey;
+}
+
+// ============================================================================
+// Operation Wrappers
+// ============================================================================
+
+static int openssl_keygen(const PQCAlgorithm *alg, uint8_t *pk, uint8_t *sk) {
+    if (!alg || !alg->context || !pk || !sk) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    openssl_alg_context_t *ctx = (openssl_alg_context_t*)alg->context;
+
+    EVP_PKEY *pkey = EVP_PKEY_Q_keygen(NULL, NULL, ctx->info->ossl_name);
+    if (!pkey) {
+        LOG_ERROR("EVP keygen failed for %s", alg->name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    size_t pk_out = 0;
+    size_t sk_out = 0;
+    int ok = EVP_PKEY_get_octet_string_param(pkey, OSSL_PKEY_PARAM_PUB_KEY,
+                                             pk, alg->pk_len, &pk_out) &&
+             EVP_PKEY_get_octet_string_param(pkey, OSSL_PKEY_PARAM_PRIV_KEY,
+                                             sk, alg->sk_len, &sk_out);
+    EVP_PKEY_free(pkey);
+
+    if (!ok || pk_out != alg->pk_len || sk_out != alg->sk_len) {
+        LOG_ERROR("Exported key sizes for %s do not match FIPS sizes "
+                  "(pk=%zu/%zu, sk=%zu/%zu)",
+                  alg->name, pk_out, alg->pk_len, sk_out, alg->sk_len);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    // Fresh material under the same buffer pointers: drop stale imports
+    invalidate_key_cache(ctx);
+
+    return PQC_SUCCESS;
+}
+
+static int openssl_kem_encaps(const PQCAlgorithm *alg, uint8_t *ct,
+                              uint8_t *ss, const uint8_t *pk) {
+    if (!alg || !alg->context || !ct || !ss || !pk) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    openssl_alg_context_t *ctx = (openssl_alg_context_t*)alg->context;
+
+    EVP_PKEY *pub = cached_pub_key(ctx, pk);
+    if (!pub) {
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    EVP_PKEY_CTX *pctx = EVP_PKEY_CTX_new_from_pkey(NULL, pub, NULL);
+    if (!pctx) {
+        EVP_PKEY_free(pub);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    size_t ct_len = alg->ct_len;
+    size_t ss_len = alg->ss_len;
+    int ok = EVP_PKEY_encapsulate_init(pctx, NULL) > 0 &&
+             EVP_PKEY_encapsulate(pctx, ct, &ct_len, ss, &ss_len) > 0;
+    EVP_PKEY_CTX_free(pctx);
+    EVP_PKEY_free(pub);
+
+    if (!ok) {
+        LOG_ERROR("EVP_PKEY_encapsulate failed for %s", alg->name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    return PQC_SUCCESS;
+}
+
+static int openssl_kem_decaps(const PQCAlgorithm *alg, uint8_t *ss,
+                              const uint8_t *ct, const uint8_t *sk) {
+    if (!alg || !alg->context || !ss || !ct || !sk) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    openssl_alg_context_t *ctx = (openssl_alg_context_t*)alg->context;
+
+    EVP_PKEY *priv = cached_priv_key(ctx, sk);
+    if (!priv) {
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    EVP_PKEY_CTX *pctx = EVP_PKEY_CTX_new_from_pkey(NULL, priv, NULL);
+    if (!pctx) {
+        EVP_PKEY_free(priv);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    size_t ss_len = alg->ss_len;
+    int ok = EVP_PKEY_decapsulate_init(pctx, NULL) > 0 &&
+             EVP_PKEY_decapsulate(pctx, ss, &ss_len, ct, alg->ct_len) > 0;
+    EVP_PKEY_CTX_free(pctx);
+    EVP_PKEY_free(priv);
+
+    if (!ok) {
+        LOG_ERROR("EVP_PKEY_decapsulate failed for %s", alg->name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    return PQC_SUCCESS;
+}
+
+static int openssl_sig_sign(const PQCAlgorithm *alg, uint8_t *sig,
+                            size_t *sig_len, const uint8_t *msg,
+                            size_t msg_len, const uint8_t *sk) {
+    if (!alg || !alg->context || !sig || !sig_len || !msg || !sk) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    openssl_alg_context_t *ctx = (openssl_alg_context_t*)alg->context;
+
+    EVP_PKEY *priv = cached_priv_key(ctx, sk);
+    if (!priv) {
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    EVP_PKEY_CTX *pctx = EVP_PKEY_CTX_new_from_pkey(NULL, priv, NULL);
+    if (!pctx) {
+        EVP_PKEY_free(priv);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    *sig_len = alg->sig_len;
+    int ok = EVP_PKEY_sign_message_init(pctx, ctx->sig_alg, NULL) > 0 &&
+             EVP_PKEY_sign(pctx, sig, sig_len, msg, msg_len) > 0;
+    EVP_PKEY_CTX_free(pctx);
+    EVP_PKEY_free(priv);
+
+    if (!ok) {
+        LOG_ERROR("EVP_PKEY_sign failed for %s", alg->name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    return PQC_SUCCESS;
+}
+
+static int openssl_sig_verify(const PQCAlgorithm *alg, const uint8_t *msg,
+                              size_t msg_len, const uint8_t *sig,
+                              size_t sig_len, const uint8_t *pk) {
+    if (!alg || !alg->context || !msg || !sig || !pk) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    openssl_alg_context_t *ctx = (openssl_alg_context_t*)alg->context;
+
+    EVP_PKEY *pub = cached_pub_key(ctx, pk);
+    if (!pub) {
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    EVP_PKEY_CTX *pctx = EVP_PKEY_CTX_new_from_pkey(NULL, pub, NULL);
+    if (!pctx) {
+        EVP_PKEY_free(pub);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    int ok = EVP_PKEY_verify_message_init(pctx, ctx->sig_alg, NULL) > 0 &&
+             EVP_PKEY_verify(pctx, sig, sig_len, msg, msg_len) > 0;
+    EVP_PKEY_CTX_free(pctx);
+    EVP_PKEY_free(pub);
+
+    if (!ok) {
+        LOG_ERROR("EVP_PKEY_verify failed for %s", alg->name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    return PQC_SUCCESS;
+}
+
+// ============================================================================
+// Algorithm Cleanup
+// ============================================================================
+
+static void openssl_algorithm_cleanup(PQCAlgorithm *alg) {
+    if (!alg) return;
+
+    if (alg->context) {
+        openssl_alg_context_t *ctx = (openssl_alg_context_t*)alg->context;
+
+        EVP_PKEY_free(ctx->pub_pkey);
+        EVP_PKEY_free(ctx->priv_pkey);
+        EVP_SIGNATURE_free(ctx->sig_alg);
+        pthread_mutex_destroy(&ctx->lock);
+
+        free(ctx);
+        alg->context = NULL;
+    }
+
+    free(alg);
+}
+
+// ============================================================================
+// Handle Construction
+// ============================================================================
+
+/**
+ * @brief Instantiate an algorithm handle from its table entry
+ */
+static PQCAlgorithm* create_handle(const openssl_alg_info_t *info) {
+    PQCAlgorithm *alg = (PQCAlgorithm*)calloc(1, sizeof(PQCAlgorithm));
+    if (!alg) {
+        LOG_ERROR("Failed to allocate PQCAlgorithm");
+        return NULL;
+    }
+
+    openssl_alg_context_t *ctx =
+        (openssl_alg_context_t*)calloc(1, sizeof(openssl_alg_context_t));
+    if (!ctx) {
+        LOG_ERROR("Failed to allocate algorithm context");
+        free(alg);
+        return NULL;
+    }
+
+    ctx->info = info;
+    pthread_mutex_init(&ctx->lock, NULL);
+
+    if (!info->is_kem) {
+        ctx->sig_alg = EVP_SIGNATURE_fetch(NULL, info->ossl_name, NULL);
+        if (!ctx->sig_alg) {
+            LOG_ERROR("OpenSSL does not provide %s", info->ossl_name);
+            pthread_mutex_destroy(&ctx->lock);
+            free(ctx);
+            free(alg);
+            return NULL;
+        }
+    }
+
+    // Own a copy of the name, matching the liboqs adapter's layout
+    strncpy(ctx->name, info->name, sizeof(ctx->name) - 1);
+    ctx->name[sizeof(ctx->name) - 1] = '\0';
+
+    alg->name = ctx->name;
+    alg->variant = ctx->name + 5;  // Skip "mlkem"/"mldsa" prefix
+    alg->provider = "openssl";
+    alg->type = info->is_kem ? PQC_ALG_TYPE_KEM : PQC_ALG_TYPE_SIGNATURE;
+    alg->keygen = openssl_keygen;
+    alg->encaps = info->is_kem ? openssl_kem_encaps : NULL;
+    alg->decaps = info->is_kem ? openssl_kem_decaps : NULL;
+    alg->sign = info->is_kem ? NULL : openssl_sig_sign;
+    alg->verify = info->is_kem ? NULL : openssl_sig_verify;
+    alg->cleanup = openssl_algorithm_cleanup;
+    alg->pk_len = info->pk_len;
+    alg->sk_len = info->sk_len;
+    alg->ct_len = info->ct_len;
+    alg->sig_len = info->sig_len;
+    alg->ss_len = info->ss_len;
+    alg->context = ctx;
+
+    LOG_DEBUG("Created OpenSSL algorithm: %s (pk=%zu, sk=%zu)",
+              info->name, alg->pk_len, alg->sk_len);
+
+    return alg;
+}
+
+#endif  // OPENSSL_HAVE_PQC
+
+// ============================================================================
+// Helper Functions Implementation
+// ============================================================================
+
+PQCAlgorithm* openssl_create_kem_algorithm(const char *name) {
+    if (!name) {
+        LOG_ERROR("Algorithm name is NULL");
+        return NULL;
+    }
+
+#if OPENSSL_HAVE_PQC
+    const openssl_alg_info_t *info = find_alg_info(name);
+    if (!info || !info->is_kem) {
+        LOG_ERROR("Unknown KEM algorithm: %s", name);
+        return NULL;
+    }
+    return create_handle(info);
+#else
+    LOG_ERROR("OpenSSL %s lacks ML-KEM support (3.5+ required)",
+              OPENSSL_VERSION_STR);
+    return NULL;
+#endif
+}
+
+PQCAlgorithm* openssl_create_sig_algorithm(const char *name) {
+    if (!name) {
+        LOG_ERROR("Algorithm name is NULL");
+        return NULL;
+    }
+
+#if OPENSSL_HAVE_PQC
+    const openssl_alg_info_t *info = find_alg_info(name);
+    if (!info || info->is_kem) {
+        LOG_ERROR("Unknown signature algorithm: %s", name);
+        return NULL;
+    }
+    return create_handle(info);
+#else
+    LOG_ERROR("OpenSSL %s lacks ML-DSA support (3.5+ required)",
+              OPENSSL_VERSION_STR);
+    return NULL;
+#endif
+}
+
+void openssl_destroy_algorithm(PQCAlgorithm *alg) {
+    if (!alg) return;
+
+    if (alg->cleanup) {
+        alg->cleanup(alg);
+    }
+}
+
+int openssl_supports_algorithm(const char *name) {
+    if (!name) return 0;
+
+    return find_alg_info(name) != NULL;
+}
+
+const char** openssl_list_algorithms(int *count) {
+    if (count) {
+        *count = 0;
+        for (int i = 0; SUPPORTED_ALGORITHMS[i] != NULL; i++) {
+            (*count)++;
+        }
+    }
+
+    return SUPPORTED_ALGORITHMS;
+}
+
+// ============================================================================
+// Provider Interface Implementation
+// ============================================================================
+
+static void* openssl_provider_init(const PQCProvider *provider) {
+    (void)provider;  // Unused
+
+#if !OPENSSL_HAVE_PQC
+    LOG_ERROR("Linked OpenSSL %s predates 3.5; ML-KEM/ML-DSA unavailable",
+              OPENSSL_VERSION_STR);
+    return NULL;
+#else
+    openssl_context_t *ctx =
+        (openssl_context_t*)calloc(1, sizeof(openssl_context_t));
+    if (!ctx) {
+        LOG_ERROR("Failed to allocate provider context");
+        return NULL;
+    }
+
+    ctx->initialized = 1;
+    LOG_INFO("OpenSSL provider initialized (%s)", OPENSSL_VERSION_STR);
+
+    return ctx;
+#endif
+}
+
+static void openssl_provider_cleanup(const PQCProvider *provider,
+                                     void *context) {
+    (void)provider;  // Unused
+
+    if (context) {
+        openssl_context_t *ctx = (openssl_context_t*)context;
+        ctx->initialized = 0;
+        free(ctx);
+        LOG_INFO("OpenSSL provider cleaned up");
+    }
+}
+
+static PQCAlgorithm* openssl_provider_create_algorithm(
+    const PQCProvider *provider, void *context, const char *algorithm_name) {
+    (void)provider;  // Unused
+
+    if (!context) {
+        LOG_ERROR("Provider context is NULL");
+        return NULL;
+    }
+
+    openssl_context_t *ctx = (openssl_context_t*)context;
+    if (!ctx->initialized) {
+        LOG_ERROR("Provider not initialized");
+        return NULL;
+    }
+
+    if (!algorithm_name) {
+        LOG_ERROR("Algorithm name is NULL");
+        return NULL;
+    }
+
+    const openssl_alg_info_t *info = find_alg_info(algorithm_name);
+    if (!info) {
+        LOG_ERROR("Unknown algorithm type: %s", algorithm_name);
+        return NULL;
+    }
+
+    return info->is_kem ? openssl_create_kem_algorithm(algorithm_name)
+                        : openssl_create_sig_algorithm(algorithm_name);
+}
+
+static void openssl_provider_destroy_algorithm(const PQCProvider *provider,
+                                               void *context,
+                                               PQCAlgorithm *alg) {
+    (void)provider;  // Unused
+    (void)context;   // Unused
+
+    openssl_destroy_algorithm(alg);
+}
+
+static const char** openssl_provider_list_algorithms(
+    const PQCProvider *provider, void *context, int *count) {
+    (void)provider;  // Unused
+    (void)context;   // Unused
+
+    return openssl_list_algorithms(count);
+}
+
+static bool openssl_provider_supports_algorithm(const PQCProvider *provider,
+                                                void *context,
+                                                const char *algorithm_name) {
+    (void)provider;  // Unused
+    (void)context;   // Unused
+
+    return openssl_supports_algorithm(algorithm_name) != 0;
+}
+
+// ============================================================================
+// Factory Function
+// ============================================================================
+
+static PQCProvider g_openssl_provider = {
+    .name = "openssl",
+    .version = OPENSSL_VERSION_STR,
+    .init = openssl_provider_init,
+    .cleanup = openssl_provider_cleanup,
+    .create_algorithm = openssl_provider_create_algorithm,
+    .destroy_algorithm = openssl_provider_destroy_algorithm,
+    .list_algorithms = openssl_provider_list_algorithms,
+    .supports_algorithm = openssl_provider_supports_algorithm,
+    .provider_data = NULL
+};
+
+PQCProvider* create_openssl_provider(void) {
+    return &g_openssl_provider;
+}
+
+void destroy_openssl_provider(PQCProvider *provider) {
+    // Provider is statically allocated, nothing to free
+    (void)provider;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file openssl_adapter.h
+ * @brief OpenSSL adapter implementation for PQC provider interface
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Provides a second concrete implementation of the PQCProvider interface
+ * using the OpenSSL 3.5+ EVP API, so liboqs and OpenSSL builds of the same
+ * algorithms can be compared head-to-head on the same silicon. Exposes the
+ * same algorithm names as the liboqs adapter (mlkem512..mldsa87); on hosts
+ * with an older OpenSSL the provider reports itself as unavailable at
+ * init time and every create call fails cleanly.
+ */
+
+#ifndef OPENSSL_ADAPTER_H
+#define OPENSSL_ADAPTER_H
+
+#include "../core/provider_interface.h"
+#include "../core/algorithm_interface.h"
+
+// ============================================================================
+// Factory Function
+// ============================================================================
+
+/**
+ * @brief Create an OpenSSL provider instance
+ * @return Pointer to PQCProvider structure, or NULL on failure
+ *
+ * The provider is statically allocated and does not need to be freed,
+ * but the context returned by init() must be cleaned up. init() fails
+ * when the linked OpenSSL predates 3.5 (no ML-KEM/ML-DSA support).
+ */
+PQCProvider* create_openssl_provider(void);
+
+/**
+ * @brief Destroy an OpenSSL provider instance
+ * @param provider Provider to destroy (currently no-op as provider is static)
+ */
+void destroy_openssl_provider(PQCProvider *provider);
+
+// ============================================================================
+// Helper Functions
+// ============================================================================
+
+/**
+ * @brief Create a KEM algorithm instance backed by OpenSSL EVP
+ * @param name Algorithm name (e.g., "mlkem512", "mlkem768", "mlkem1024")
+ * @return Pointer to PQCAlgorithm, or NULL on failure
+ *
+ * Unlike the liboqs adapter, handles are not shared between callers: each
+ * handle carries a mutable cache of imported EVP_PKEY objects, keyed on
+ * the raw key buffer the engine reuses across iterations, so repeated
+ * operations skip the raw-byte import after the first call.
+ */
+PQCAlgorithm* openssl_create_kem_algorithm(const char *name);
+
+/**
+ * @brief Create a signature algorithm instance backed by OpenSSL EVP
+ * @param name Algorithm name (e.g., "mldsa44", "mldsa65", "mldsa87")
+ * @return Pointer to PQCAlgorithm, or NULL on failure
+ */
+PQCAlgorithm* openssl_create_sig_algorithm(const char *name);
+
+/**
+ * @brief Release an algorithm handle obtained from the OpenSSL adapter
+ * @param alg Algorithm to release
+ */
+void openssl_destroy_algorithm(PQCAlgorithm *alg);
+
+/**
+ * @brief Check if an algorithm name is supported by the OpenSSL adapter
+ * @param name Algorithm name to check
+ * @return 1 if supported, 0 otherwise
+ */
+int openssl_supports_algorithm(const char *name);
+
+/**
+ * @brief Get list of all supported algorithms
+ * @param count Output: number of algorithms
+ * @return Array of algorithm name strings (static, do not free)
+ */
+const char** openssl_list_algorithms(int *count);
+
+#endif // OPENSSL_ADAPTER_H
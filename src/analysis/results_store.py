@@ -0,0 +1,370 @@
+#!/usr/bin/env python3
+"""
+Query API and importer for the indexed consolidated results store
+
+The C side (src/utils/results_store.c) appends each BenchmarkResultSet to
+a single binary file: a header, a 1024-slot hash bucket table, then
+fixed-size records. Each record links to the previous record of the same
+(algorithm, operation, architecture) series, newest-first, and the bucket
+table holds each chain's head. A fully-keyed trend query hashes straight
+to its chain and walks it until the time horizon, so "mlkem768 decaps
+median on arm64, last 90 days" reads a few hundred records no matter how
+many millions the store holds.
+
+This module also imports the legacy per-run JSON files from results/ so
+existing campaign history lands in the same store.
+
+Location: src/analysis/results_store.py
+"""
+
+import json
+import struct
+import time
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Iterator, List, Optional
+
+# Must match pqc_store_header_t / pqc_store_record_t in
+# src/utils/results_store.h
+STORE_FILE_MAGIC = b"PQCSTOR1"
+NUM_BUCKETS = 1024
+
+_HEADER_FORMAT = "<8sIIIIQ"
+_HEADER_SIZE = struct.calcsize(_HEADER_FORMAT)  # 32 bytes
+
+_RECORD_FORMAT = "<QQ32s16s16sIIII10d"
+_RECORD_SIZE = struct.calcsize(_RECORD_FORMAT)  # 176 bytes
+
+FLAG_COLD_CACHE = 0x1
+FLAG_THROTTLED = 0x2
+FLAG_REGRESSED = 0x4
+
+_FNV_OFFSET_BASIS = 0xcbf29ce484222325
+_FNV_PRIME = 0x100000001B3
+_FNV_MASK = 0xFFFFFFFFFFFFFFFF
+
+
+def _bucket(algorithm: str, operation: str, architecture: str,
+            num_buckets: int) -> int:
+    """FNV-1a series hash; must match pqc_store_bucket() in C."""
+    h = _FNV_OFFSET_BASIS
+    for name in (algorithm, operation, architecture):
+        for byte in name.encode("ascii"):
+            h = ((h ^ byte) * _FNV_PRIME) & _FNV_MASK
+        h = (h * _FNV_PRIME) & _FNV_MASK  # NUL separator
+    return h % num_buckets
+
+
+def _decode_field(raw: bytes) -> str:
+    """Decode a NUL-padded fixed-width record string."""
+    return raw.split(b"\x00", 1)[0].decode("ascii")
+
+
+@dataclass
+class StoreRecord:
+    """One benchmark result row as stored on disk (times in microseconds)."""
+
+    timestamp: int
+    algorithm: str
+    operation: str
+    architecture: str
+    num_samples: int
+    warmup_iterations: int
+    flags: int
+    batch_size: int
+    mean: float
+    median: float
+    std_dev: float
+    min: float
+    max: float
+    p95: float
+    p99: float
+    p999: float
+    throughput_ops_sec: float
+    amortized_ns_op: float
+
+    @property
+    def cold_cache(self) -> bool:
+        return bool(self.flags & FLAG_COLD_CACHE)
+
+    @property
+    def throttled(self) -> bool:
+        return bool(self.flags & FLAG_THROTTLED)
+
+    @property
+    def regressed(self) -> bool:
+        return bool(self.flags & FLAG_REGRESSED)
+
+
+class ResultsStore:
+    """Reader/writer for one store file.
+
+    Reads never scan unless the query leaves part of the series key open;
+    writes replicate the C appender so the import tool produces files the
+    engine can keep appending to.
+    """
+
+    def __init__(self, path, create: bool = False):
+        self.path = Path(path)
+        if create and not self.path.exists():
+            self._format()
+        self._fp = open(self.path, "r+b" if create else "rb")
+        self._read_header()
+
+    def close(self):
+        self._fp.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    # -- file format ------------------------------------------------------
+
+    def _format(self):
+        header = struct.pack(
+            _HEADER_FORMAT, STORE_FILE_MAGIC,
+            _HEADER_SIZE + NUM_BUCKETS * 8, _RECORD_SIZE, NUM_BUCKETS, 0, 0)
+        with open(self.path, "wb") as f:
+            f.write(header)
+            f.write(b"\x00" * (NUM_BUCKETS * 8))
+
+    def _read_header(self):
+        self._fp.seek(0)
+        raw = self._fp.read(_HEADER_SIZE)
+        if len(raw) < _HEADER_SIZE:
+            raise ValueError(f"{self.path}: truncated header")
+        (magic, self.header_size, record_size, self.num_buckets, _,
+         self.num_records) = struct.unpack(_HEADER_FORMAT, raw)
+        if magic != STORE_FILE_MAGIC:
+            raise ValueError(f"{self.path}: bad magic {magic!r}")
+        if record_size != _RECORD_SIZE:
+            raise ValueError(
+                f"{self.path}: record size {record_size} != {_RECORD_SIZE}")
+
+    def _read_record(self, offset: int):
+        self._fp.seek(offset)
+        raw = self._fp.read(_RECORD_SIZE)
+        if len(raw) < _RECORD_SIZE:
+            raise ValueError(f"{self.path}: truncated record at {offset}")
+        fields = struct.unpack(_RECORD_FORMAT, raw)
+        prev_offset = fields[0]
+        record = StoreRecord(
+            timestamp=fields[1],
+            algorithm=_decode_field(fields[2]),
+            operation=_decode_field(fields[3]),
+            architecture=_decode_field(fields[4]),
+            num_samples=fields[5],
+            warmup_iterations=fields[6],
+            flags=fields[7],
+            batch_size=fields[8],
+            mean=fields[9], median=fields[10], std_dev=fields[11],
+            min=fields[12], max=fields[13], p95=fields[14], p99=fields[15],
+            p999=fields[16], throughput_ops_sec=fields[17],
+            amortized_ns_op=fields[18],
+        )
+        return prev_offset, record
+
+    def _bucket_head(self, bucket: int) -> int:
+        self._fp.seek(_HEADER_SIZE + bucket * 8)
+        return struct.unpack("<Q", self._fp.read(8))[0]
+
+    # -- queries ----------------------------------------------------------
+
+    def _walk_chain(self, algorithm: str, operation: str, architecture: str,
+                    since: Optional[int]) -> Iterator[StoreRecord]:
+        """Walk one series chain newest-first, stopping at the horizon.
+
+        Chains are reverse-chronological by construction, so the first
+        record older than `since` ends the walk. Colliding series in the
+        same bucket are filtered by key.
+        """
+        offset = self._bucket_head(
+            _bucket(algorithm, operation, architecture, self.num_buckets))
+        while offset != 0:
+            prev_offset, record = self._read_record(offset)
+            if since is not None and record.timestamp < since:
+                break
+            if (record.algorithm == algorithm
+                    and record.operation == operation
+                    and record.architecture == architecture):
+                yield record
+            offset = prev_offset
+
+    def query(self, algorithm: Optional[str] = None,
+              operation: Optional[str] = None,
+              architecture: Optional[str] = None,
+              since: Optional[int] = None,
+              until: Optional[int] = None,
+              limit: Optional[int] = None) -> List[StoreRecord]:
+        """Return matching records, newest first.
+
+        With the full series key the index answers without a scan; a
+        partially-keyed query falls back to one sequential pass over the
+        fixed-size record region.
+        """
+        if algorithm and operation and architecture:
+            records = self._walk_chain(algorithm, operation, architecture,
+                                       since)
+        else:
+            records = self._scan(algorithm, operation, architecture, since)
+
+        out = []
+        for record in records:
+            if until is not None and record.timestamp > until:
+                continue
+            out.append(record)
+            if limit is not None and len(out) >= limit:
+                break
+        if not (algorithm and operation and architecture):
+            out.sort(key=lambda r: r.timestamp, reverse=True)
+        return out
+
+    def _scan(self, algorithm, operation, architecture,
+              since) -> Iterator[StoreRecord]:
+        self._fp.seek(0, 2)
+        end = self._fp.tell()
+        offset = self.header_size
+        while offset + _RECORD_SIZE <= end:
+            _, record = self._read_record(offset)
+            offset += _RECORD_SIZE
+            if algorithm and record.algorithm != algorithm:
+                continue
+            if operation and record.operation != operation:
+                continue
+            if architecture and record.architecture != architecture:
+                continue
+            if since is not None and record.timestamp < since:
+                continue
+            yield record
+
+    # -- appends ----------------------------------------------------------
+
+    def append(self, record: StoreRecord):
+        """Append one record, mirroring pqc_results_store_append()."""
+        bucket = _bucket(record.algorithm, record.operation,
+                         record.architecture, self.num_buckets)
+        head = self._bucket_head(bucket)
+
+        self._fp.seek(0, 2)
+        offset = self._fp.tell()
+        self._fp.write(struct.pack(
+            _RECORD_FORMAT, head, record.timestamp,
+            record.algorithm.encode("ascii"),
+            record.operation.encode("ascii"),
+            record.architecture.encode("ascii"),
+            record.num_samples, record.warmup_iterations, record.flags,
+            record.batch_size, record.mean, record.median, record.std_dev,
+            record.min, record.max, record.p95, record.p99, record.p999,
+            record.throughput_ops_sec, record.amortized_ns_op))
+
+        self._fp.seek(_HEADER_SIZE + bucket * 8)
+        self._fp.write(struct.pack("<Q", offset))
+
+        self.num_records += 1
+        self._fp.seek(0)
+        self._fp.write(struct.pack(
+            _HEADER_FORMAT, STORE_FILE_MAGIC, self.header_size, _RECORD_SIZE,
+            self.num_buckets, 0, self.num_records))
+        self._fp.flush()
+
+
+def import_json(store: ResultsStore, path) -> int:
+    """Import one legacy per-run JSON file; returns records imported.
+
+    The file's mtime stands in for the run timestamp, which is the best
+    the legacy files carry.
+    """
+    path = Path(path)
+    timestamp = int(path.stat().st_mtime)
+    with open(path) as f:
+        data = json.load(f)
+
+    imported = 0
+    for row in data.get("results", []):
+        store.append(StoreRecord(
+            timestamp=timestamp,
+            algorithm=row.get("algorithm", data.get("algorithm", "unknown")),
+            operation=row["operation"],
+            architecture=data.get("architecture", "unknown"),
+            num_samples=int(row.get("num_samples", 0)),
+            warmup_iterations=int(row.get("warmup_iterations", 0)),
+            flags=(FLAG_COLD_CACHE if row.get("cold_cache") else 0)
+                | (FLAG_THROTTLED if row.get("throttled") else 0),
+            batch_size=int(row.get("batch_size", 1)),
+            mean=float(row.get("mean_us", 0.0)),
+            median=float(row.get("median_us", 0.0)),
+            std_dev=float(row.get("stddev_us", 0.0)),
+            min=float(row.get("min_us", 0.0)),
+            max=float(row.get("max_us", 0.0)),
+            p95=float(row.get("p95_us", 0.0)),
+            p99=float(row.get("p99_us", 0.0)),
+            p999=float(row.get("p999_us", 0.0)),
+            throughput_ops_sec=float(row.get("throughput_ops_sec", 0.0)),
+            amortized_ns_op=float(row.get("amortized_ns_op", 0.0)),
+        ))
+        imported += 1
+    return imported
+
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description="Query and maintain the consolidated results store")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p_import = sub.add_parser(
+        "import", help="Import legacy per-run JSON files")
+    p_import.add_argument("store", help="Store file (created if absent)")
+    p_import.add_argument("files", nargs="+", help="JSON result files")
+
+    p_query = sub.add_parser("query", help="Query records")
+    p_query.add_argument("store")
+    p_query.add_argument("-a", "--algorithm")
+    p_query.add_argument("-o", "--operation")
+    p_query.add_argument("-A", "--architecture")
+    p_query.add_argument("--days", type=float,
+                         help="Only records from the last N days")
+    p_query.add_argument("--limit", type=int)
+
+    p_info = sub.add_parser("info", help="Print store summary")
+    p_info.add_argument("store")
+
+    args = parser.parse_args()
+
+    if args.command == "import":
+        with ResultsStore(args.store, create=True) as store:
+            total = 0
+            for path in args.files:
+                n = import_json(store, path)
+                total += n
+                print(f"{path}: {n} records")
+            print(f"Imported {total} records "
+                  f"({store.num_records} total in store)")
+    elif args.command == "query":
+        since = None
+        if args.days is not None:
+            since = int(time.time() - args.days * 86400)
+        with ResultsStore(args.store) as store:
+            records = store.query(
+                algorithm=args.algorithm, operation=args.operation,
+                architecture=args.architecture, since=since,
+                limit=args.limit)
+            for r in records:
+                stamp = time.strftime("%Y-%m-%d %H:%M",
+                                      time.localtime(r.timestamp))
+                print(f"{stamp} {r.algorithm:12} {r.operation:12} "
+                      f"[{r.architecture}] n={r.num_samples} "
+                      f"median={r.median:.2f}us p99={r.p99:.2f}us")
+            print(f"{len(records)} records")
+    elif args.command == "info":
+        with ResultsStore(args.store) as store:
+            print(f"{store.path}: {store.num_records} records, "
+                  f"{store.num_buckets} buckets, "
+                  f"record size {_RECORD_SIZE} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Zero-copy loader for binary raw-sample dumps
+
+The C benchmark engine can dump raw timing samples as binary columnar
+files (pqc_benchmark_write_samples() in src/benchmarks/generic_benchmark.c):
+an 88-byte header with algorithm/operation/architecture metadata followed
+by one little-endian uint64 column of per-operation nanosecond samples.
+
+This module maps those files into numpy arrays with np.memmap, so loading
+a 10M-sample column costs a page-table setup instead of a JSON parse, and
+downstream tests (Mann-Whitney, bootstrap) run on the real distributions.
+
+Location: src/analysis/sample_loader.py
+"""
+
+import struct
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Iterator, List
+
+import numpy as np
+
+# Must match pqc_sample_file_header_t in src/core/benchmark_engine.h
+SAMPLE_FILE_MAGIC = b"PQCSMPL1"
+_HEADER_FORMAT = "<8sIIQ32s16s16s"
+_HEADER_SIZE = struct.calcsize(_HEADER_FORMAT)  # 88 bytes
+
+
+@dataclass
+class SampleColumn:
+    """One operation's raw timing samples plus its header metadata."""
+
+    algorithm: str
+    operation: str
+    architecture: str
+    path: Path
+    samples: np.ndarray = field(repr=False)  # uint64 nanoseconds, memory-mapped
+
+    @property
+    def num_samples(self) -> int:
+        return len(self.samples)
+
+    def as_microseconds(self) -> np.ndarray:
+        """Return samples converted to microseconds (copies into float64)."""
+        return self.samples.astype(np.float64) / 1000.0
+
+
+def _decode_field(raw: bytes) -> str:
+    """Decode a NUL-padded fixed-width header string."""
+    return raw.split(b"\x00", 1)[0].decode("ascii")
+
+
+def load_samples(path) -> SampleColumn:
+    """Load one .samples file as a zero-copy memory-mapped column.
+
+    Raises ValueError if the file is not a valid sample dump.
+    """
+    path = Path(path)
+
+    with open(path, "rb") as f:
+        raw_header = f.read(_HEADER_SIZE)
+
+    if len(raw_header) < _HEADER_SIZE:
+        raise ValueError(f"{path}: truncated header")
+
+    (magic, header_size, sample_width, num_samples,
+     algorithm, operation, architecture) = struct.unpack(_HEADER_FORMAT, raw_header)
+
+    if magic != SAMPLE_FILE_MAGIC:
+        raise ValueError(f"{path}: bad magic {magic!r}")
+    if sample_width != 8:
+        raise ValueError(f"{path}: unsupported sample width {sample_width}")
+
+    samples = np.memmap(path, dtype="<u8", mode="r",
+                        offset=header_size, shape=(num_samples,))
+
+    return SampleColumn(
+        algorithm=_decode_field(algorithm),
+        operation=_decode_field(operation),
+        architecture=_decode_field(architecture),
+        path=path,
+        samples=samples,
+    )
+
+
+def iter_sample_files(directory) -> Iterator[SampleColumn]:
+    """Yield SampleColumn objects for every .samples file in a directory."""
+    for path in sorted(Path(directory).glob("*.samples")):
+        yield load_samples(path)
+
+
+def load_directory(directory) -> List[SampleColumn]:
+    """Load all .samples files in a directory (see iter_sample_files)."""
+    return list(iter_sample_files(directory))
+
+
+def main():
+    """Print a summary of every sample dump in a directory."""
+    import argparse
+
+    parser = argparse.ArgumentParser(description="Inspect binary sample dumps")
+    parser.add_argument("directory", help="Directory containing .samples files")
+    args = parser.parse_args()
+
+    columns = load_directory(args.directory)
+    if not columns:
+        print(f"No .samples files found in {args.directory}")
+        return
+
+    for col in columns:
+        us = col.as_microseconds()
+        print(f"{col.algorithm:12} {col.operation:8} [{col.architecture}] "
+              f"n={col.num_samples}: mean={us.mean():.2f}us "
+              f"p50={np.percentile(us, 50):.2f}us p99={np.percentile(us, 99):.2f}us")
+
+
+if __name__ == "__main__":
+    main()
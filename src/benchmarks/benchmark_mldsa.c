@@ -17,6 +17,7 @@
 
 #include "generic_benchmark.h"
 #include "../adapters/liboqs_adapter.h"
+#include "../adapters/liboqs_direct.h"
 #include "../utils/logger.h"
 
 // ============================================================================
@@ -26,6 +27,7 @@
 #define DEFAULT_ITERATIONS 1000
 #define DEFAULT_WARMUP_ITERATIONS 100
 #define OUTLIER_MULTIPLIER 1.5
+#define MAX_MESSAGE_SIZES 16
 
 // ML-DSA algorithm names
 static const char *MLDSA_ALGORITHMS[] = {
@@ -43,10 +45,25 @@ static const int NUM_ALGORITHMS = sizeof(MLDSA_ALGORITHMS) / sizeof(MLDSA_ALGORI
 typedef struct {
     int iterations;
     int warmup;
+    int adaptive_warmup;
     int remove_outliers;
     int verbose;
+    int parallel;
     const char *output_json;
     const char *output_csv;
+    const char *sample_dir;
+    const char *corpus_dir;
+    int perf_counters;
+    double adaptive_ci;
+    int max_iterations;
+    int cold_cache;
+    int pin_cpu;
+    int telemetry;
+    const char *checkpoint_dir;
+    const char *baseline_dir;
+    double regression_threshold;
+    size_t message_sizes[MAX_MESSAGE_SIZES];
+    int num_message_sizes;
 } cli_config_t;
 
 static void print_usage(const char *program_name) {
@@ -54,10 +71,30 @@ static void print_usage(const char *program_name) {
     printf("\nOptions:\n");
     printf("  -i <num>    Number of iterations (default: %d)\n", DEFAULT_ITERATIONS);
     printf("  -w <num>    Warmup iterations (default: %d)\n", DEFAULT_WARMUP_ITERATIONS);
+    printf("  -W          Adaptive warmup: warm up until the rolling-window\n");
+    printf("              median stabilizes, instead of a fixed -w count\n");
     printf("  -r          Remove outliers using IQR method\n");
     printf("  -v          Verbose output\n");
+    printf("  -p <num>    Run with <num> parallel workers (default: sequential)\n");
     printf("  -j <file>   Save results to JSON file\n");
     printf("  -c <file>   Save results to CSV file\n");
+    printf("  -d <dir>    Dump raw timing samples as binary files in <dir>\n");
+    printf("  -k <dir>    Use (and build) a keypair corpus cache in <dir>\n");
+    printf("  -e          Sample hardware counters (cycles, IPC, cache misses)\n");
+    printf("  -a <rel>    Adaptive sampling: stop at relative CI half-width <rel>\n");
+    printf("              (e.g. 0.01 for ±1%%); -i becomes the minimum\n");
+    printf("  -m <num>    Iteration cap in adaptive mode (default: 100000)\n");
+    printf("  -s <list>   Message-size sweep for sign/verify, comma-separated bytes\n");
+    printf("              (e.g. 2048,65536,1048576)\n");
+    printf("  -C          Cold-cache mode: evict the working set before each sample\n");
+    printf("  -x <cpu>    Pin the measurement thread to core <cpu>\n");
+    printf("  -t          Sample core frequency and temperature during runs\n");
+    printf("  -K <dir>    Checkpoint samples to spill files in <dir>; an\n");
+    printf("              interrupted run resumes from the last marker\n");
+    printf("  -B <dir>    Gate against a baseline sample dump (written with -d):\n");
+    printf("              exit 2 when an operation's median regresses\n");
+    printf("  -T <rel>    Median slowdown that fails the -B gate\n");
+    printf("              (default: 0.05 = 5%%)\n");
     printf("  -h          Show this help message\n");
     printf("\n");
 }
@@ -66,14 +103,28 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
     // Initialize defaults
     config->iterations = DEFAULT_ITERATIONS;
     config->warmup = DEFAULT_WARMUP_ITERATIONS;
+    config->adaptive_warmup = 0;
     config->remove_outliers = 0;
     config->verbose = 0;
+    config->parallel = 0;
     config->output_json = NULL;
     config->output_csv = NULL;
-    
+    config->sample_dir = NULL;
+    config->corpus_dir = NULL;
+    config->perf_counters = 0;
+    config->adaptive_ci = 0.0;
+    config->max_iterations = 0;
+    config->cold_cache = 0;
+    config->pin_cpu = -1;
+    config->telemetry = 0;
+    config->checkpoint_dir = NULL;
+    config->baseline_dir = NULL;
+    config->regression_threshold = 0.05;
+    config->num_message_sizes = 0;
+
     // Parse arguments
     int opt;
-    while ((opt = getopt(argc, argv, "i:w:rvj:c:h")) != -1) {
+    while ((opt = getopt(argc, argv, "i:w:Wrvp:j:c:d:k:ea:m:s:Cx:tK:B:T:h")) != -1) {
         switch (opt) {
             case 'i':
                 config->iterations = atoi(optarg);
@@ -81,18 +132,72 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
             case 'w':
                 config->warmup = atoi(optarg);
                 break;
+            case 'W':
+                config->adaptive_warmup = 1;
+                break;
             case 'r':
                 config->remove_outliers = 1;
                 break;
             case 'v':
                 config->verbose = 1;
                 break;
+            case 'p':
+                config->parallel = atoi(optarg);
+                break;
             case 'j':
                 config->output_json = optarg;
                 break;
             case 'c':
                 config->output_csv = optarg;
                 break;
+            case 'd':
+                config->sample_dir = optarg;
+                break;
+            case 'k':
+                config->corpus_dir = optarg;
+                break;
+            case 'e':
+                config->perf_counters = 1;
+                break;
+            case 'a':
+                config->adaptive_ci = atof(optarg);
+                break;
+            case 'm':
+                config->max_iterations = atoi(optarg);
+                break;
+            case 's': {
+                char *cursor = optarg;
+                while (*cursor != '\0' &&
+                       config->num_message_sizes < MAX_MESSAGE_SIZES) {
+                    char *end = NULL;
+                    unsigned long long size = strtoull(cursor, &end, 10);
+                    if (end == cursor || size == 0) {
+                        fprintf(stderr, "Invalid message size list: %s\n", optarg);
+                        exit(1);
+                    }
+                    config->message_sizes[config->num_message_sizes++] = (size_t)size;
+                    cursor = (*end == ',') ? end + 1 : end;
+                }
+                break;
+            }
+            case 'C':
+                config->cold_cache = 1;
+                break;
+            case 'x':
+                config->pin_cpu = atoi(optarg);
+                break;
+            case 't':
+                config->telemetry = 1;
+                break;
+            case 'K':
+                config->checkpoint_dir = optarg;
+                break;
+            case 'B':
+                config->baseline_dir = optarg;
+                break;
+            case 'T':
+                config->regression_threshold = atof(optarg);
+                break;
             case 'h':
                 print_usage(argv[0]);
                 exit(0);
@@ -103,6 +208,75 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
     }
 }
 
+// ============================================================================
+// Result Output Helpers
+// ============================================================================
+
+/**
+ * @brief Build per-algorithm output path and write results in one format
+ *
+ * Inserts the algorithm name into the user-supplied path so each algorithm
+ * gets its own file (e.g., "results/out.json" -> "results/mldsa44_out.json").
+ */
+static int write_output_file(const char *base_path, const char *alg_name,
+                             const BenchmarkResultSet *results, int as_json) {
+    char out_path[512];
+    const char *last_slash = strrchr(base_path, '/');
+    const char *last_dot = strrchr(base_path, '.');
+
+    if (last_slash && last_dot && last_dot > last_slash) {
+        // Extract directory, base name, and extension
+        size_t dir_len = last_slash - base_path + 1;
+        size_t base_len = last_dot - last_slash - 1;
+
+        char dir[256];
+        char base[128];
+        const char *ext = last_dot;
+
+        strncpy(dir, base_path, dir_len);
+        dir[dir_len] = '\0';
+
+        strncpy(base, last_slash + 1, base_len);
+        base[base_len] = '\0';
+
+        snprintf(out_path, sizeof(out_path), "%s%s_%s%s", dir, alg_name, base, ext);
+    } else {
+        // Fallback: prepend algorithm name
+        snprintf(out_path, sizeof(out_path), "%s_%s", alg_name, base_path);
+    }
+
+    int ret = as_json ? pqc_benchmark_write_json(results, out_path)
+                      : pqc_benchmark_write_csv(results, out_path);
+    if (ret != 0) {
+        LOG_ERROR("Failed to write %s results", as_json ? "JSON" : "CSV");
+    } else {
+        LOG_INFO("Wrote %s results to %s", as_json ? "JSON" : "CSV", out_path);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Print and persist results for one algorithm according to CLI config
+ */
+static void output_results(const cli_config_t *cli_config, const char *alg_name,
+                           const BenchmarkResultSet *results) {
+    printf("\n");
+    pqc_benchmark_print_results(results);
+
+    if (cli_config->output_json) {
+        write_output_file(cli_config->output_json, alg_name, results, 1);
+    }
+
+    if (cli_config->output_csv) {
+        write_output_file(cli_config->output_csv, alg_name, results, 0);
+    }
+
+    if (cli_config->sample_dir) {
+        pqc_benchmark_write_samples(results, cli_config->sample_dir);
+    }
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -121,6 +295,12 @@ int main(int argc, char *argv[]) {
         .include_source_info = 0
     };
     logger_init(logger_config);
+
+    // Async logging keeps I/O off the measurement path; logger_close()
+    // drains the ring on every exit below
+    if (logger_async_start() != 0) {
+        LOG_WARN("Async logger unavailable, falling back to synchronous logging");
+    }
     
     // Print configuration
     LOG_INFO("=== ML-DSA Benchmark Configuration ===");
@@ -129,8 +309,9 @@ int main(int argc, char *argv[]) {
     LOG_INFO("Remove outliers: %s", cli_config.remove_outliers ? "yes" : "no");
     LOG_INFO("======================================");
     
-    // Create liboqs provider
+    // Create liboqs provider and install its direct measurement kernels
     PQCProvider *provider = create_liboqs_provider();
+    liboqs_register_direct_loops();
     if (!provider) {
         LOG_ERROR("Failed to create liboqs provider");
         logger_close();
@@ -153,10 +334,101 @@ int main(int argc, char *argv[]) {
     bench_config.verbose = cli_config.verbose;
     bench_config.remove_outliers = cli_config.remove_outliers;
     bench_config.outlier_threshold = OUTLIER_MULTIPLIER;
-    
+    bench_config.parallel_workers = cli_config.parallel;
+    bench_config.corpus_dir = cli_config.corpus_dir;
+    bench_config.perf_counters = (cli_config.perf_counters != 0);
+    bench_config.cold_cache = (cli_config.cold_cache != 0);
+    bench_config.pin_cpu = cli_config.pin_cpu;
+    bench_config.cpu_telemetry = (cli_config.telemetry != 0);
+    bench_config.adaptive_warmup = (cli_config.adaptive_warmup != 0);
+    bench_config.checkpoint_dir = cli_config.checkpoint_dir;
+    bench_config.baseline_dir = cli_config.baseline_dir;
+    if (cli_config.regression_threshold > 0.0) {
+        bench_config.regression_threshold = cli_config.regression_threshold;
+    }
+    if (cli_config.adaptive_ci > 0.0) {
+        bench_config.adaptive_sampling = true;
+        bench_config.ci_target = cli_config.adaptive_ci;
+        if (cli_config.max_iterations > 0) {
+            bench_config.max_iterations = cli_config.max_iterations;
+        }
+    }
+    if (cli_config.num_message_sizes > 0) {
+        bench_config.message_sizes = cli_config.message_sizes;
+        bench_config.num_message_sizes = cli_config.num_message_sizes;
+    }
+
+    // Parallel mode: fan all (algorithm, operation) pairs out to a worker pool
+    if (cli_config.parallel > 1) {
+        LOG_INFO("Running in parallel mode with %d workers", cli_config.parallel);
+
+        const PQCAlgorithm *algs[NUM_ALGORITHMS];
+        int num_created = 0;
+        int failed = 0;
+
+        for (int i = 0; i < NUM_ALGORITHMS; i++) {
+            PQCAlgorithm *alg = provider->create_algorithm(provider, provider_ctx,
+                                                           MLDSA_ALGORITHMS[i]);
+            if (!alg) {
+                LOG_ERROR("Failed to create algorithm: %s", MLDSA_ALGORITHMS[i]);
+                failed++;
+                continue;
+            }
+            algs[num_created++] = alg;
+        }
+
+        BenchmarkResultSet **result_sets = NULL;
+        int regressions = 0;
+        int ret = 0;
+        if (num_created > 0) {
+            ret = pqc_benchmark_algorithms_parallel(algs, num_created,
+                                                    &bench_config, &result_sets);
+        }
+
+        if (ret != 0 || !result_sets) {
+            LOG_ERROR("Parallel benchmark campaign failed");
+            failed += num_created;
+        } else {
+            for (int i = 0; i < num_created; i++) {
+                output_results(&cli_config, algs[i]->name, result_sets[i]);
+                int reg = pqc_benchmark_result_set_regressions(result_sets[i]);
+                if (reg > 0) {
+                    regressions += reg;
+                }
+                pqc_benchmark_result_set_free(result_sets[i]);
+            }
+            free(result_sets);
+        }
+
+        for (int i = 0; i < num_created; i++) {
+            provider->destroy_algorithm(provider, provider_ctx,
+                                        (PQCAlgorithm*)algs[i]);
+        }
+
+        provider->cleanup(provider, provider_ctx);
+
+        printf("\n");
+        if (failed == 0) {
+            LOG_INFO("All benchmarks completed successfully");
+        } else {
+            LOG_ERROR("%d/%d benchmarks failed", failed, NUM_ALGORITHMS);
+        }
+
+        if (regressions > 0) {
+            LOG_ERROR("%d operation(s) regressed beyond %.0f%% of baseline",
+                      regressions, bench_config.regression_threshold * 100.0);
+            logger_close();
+            return 2;
+        }
+
+        logger_close();
+        return (failed == 0) ? 0 : 1;
+    }
+
     // Run benchmarks
     int total_benchmarks = 0;
     int failed_benchmarks = 0;
+    int regressions = 0;
     
     for (int i = 0; i < NUM_ALGORITHMS; i++) {
         const char *alg_name = MLDSA_ALGORITHMS[i];
@@ -191,83 +463,14 @@ int main(int argc, char *argv[]) {
             continue;
         }
         
-        // Print results
-        printf("\n");
-        pqc_benchmark_print_results(results);
-        
-        // Save results if requested
-        if (cli_config.output_json) {
-            char json_path[512];
-            // Generate unique filename per algorithm
-            const char *base_path = cli_config.output_json;
-            const char *last_slash = strrchr(base_path, '/');
-            const char *last_dot = strrchr(base_path, '.');
-            
-            if (last_slash && last_dot && last_dot > last_slash) {
-                // Extract directory, base name, and extension
-                size_t dir_len = last_slash - base_path + 1;
-                size_t base_len = last_dot - last_slash - 1;
-                
-                char dir[256];
-                char base[128];
-                const char *ext = last_dot;
-                
-                strncpy(dir, base_path, dir_len);
-                dir[dir_len] = '\0';
-                
-                strncpy(base, last_slash + 1, base_len);
-                base[base_len] = '\0';
-                
-                snprintf(json_path, sizeof(json_path), "%s%s_%s%s", dir, alg_name, base, ext);
-            } else {
-                // Fallback: prepend algorithm name
-                snprintf(json_path, sizeof(json_path), "%s_%s", alg_name, base_path);
-            }
-            
-            ret = pqc_benchmark_write_json(results, json_path);
-            if (ret != 0) {
-                LOG_ERROR("Failed to write JSON results");
-            } else {
-                LOG_INFO("Wrote JSON results to %s", json_path);
-            }
-        }
-        
-        if (cli_config.output_csv) {
-            char csv_path[512];
-            // Generate unique filename per algorithm
-            const char *base_path = cli_config.output_csv;
-            const char *last_slash = strrchr(base_path, '/');
-            const char *last_dot = strrchr(base_path, '.');
-            
-            if (last_slash && last_dot && last_dot > last_slash) {
-                // Extract directory, base name, and extension
-                size_t dir_len = last_slash - base_path + 1;
-                size_t base_len = last_dot - last_slash - 1;
-                
-                char dir[256];
-                char base[128];
-                const char *ext = last_dot;
-                
-                strncpy(dir, base_path, dir_len);
-                dir[dir_len] = '\0';
-                
-                strncpy(base, last_slash + 1, base_len);
-                base[base_len] = '\0';
-                
-                snprintf(csv_path, sizeof(csv_path), "%s%s_%s%s", dir, alg_name, base, ext);
-            } else {
-                // Fallback: prepend algorithm name
-                snprintf(csv_path, sizeof(csv_path), "%s_%s", alg_name, base_path);
-            }
-            
-            ret = pqc_benchmark_write_csv(results, csv_path);
-            if (ret != 0) {
-                LOG_ERROR("Failed to write CSV results");
-            } else {
-                LOG_INFO("Wrote CSV results to %s", csv_path);
-            }
+        // Print and save results
+        output_results(&cli_config, alg_name, results);
+
+        int reg = pqc_benchmark_result_set_regressions(results);
+        if (reg > 0) {
+            regressions += reg;
         }
-        
+
         // Cleanup
         pqc_benchmark_result_set_free(results);
         provider->destroy_algorithm(provider, provider_ctx, alg);
@@ -284,6 +487,15 @@ int main(int argc, char *argv[]) {
         LOG_ERROR("%d/%d benchmarks failed", failed_benchmarks, total_benchmarks);
     }
     
+    // Regression gate: distinct exit code so CI can tell "benchmark broke"
+    // from "benchmark ran fine but got slower"
+    if (regressions > 0) {
+        LOG_ERROR("%d operation(s) regressed beyond %.0f%% of baseline",
+                  regressions, bench_config.regression_threshold * 100.0);
+        logger_close();
+        return 2;
+    }
+
     logger_close();
     return (failed_benchmarks == 0) ? 0 : 1;
 }
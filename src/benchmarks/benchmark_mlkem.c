@@ -17,6 +17,7 @@
 
 #include "generic_benchmark.h"
 #include "../adapters/liboqs_adapter.h"
+#include "../adapters/liboqs_direct.h"
 #include "../utils/logger.h"
 
 // ============================================================================
@@ -43,10 +44,23 @@ static const int NUM_ALGORITHMS = sizeof(MLKEM_ALGORITHMS) / sizeof(MLKEM_ALGORI
 typedef struct {
     int iterations;
     int warmup;
+    int adaptive_warmup;
     int remove_outliers;
     int verbose;
+    int parallel;
     const char *output_json;
     const char *output_csv;
+    const char *sample_dir;
+    const char *corpus_dir;
+    int perf_counters;
+    double adaptive_ci;
+    int max_iterations;
+    int cold_cache;
+    int pin_cpu;
+    int telemetry;
+    const char *checkpoint_dir;
+    const char *baseline_dir;
+    double regression_threshold;
 } cli_config_t;
 
 static void print_usage(const char *prog_name) {
@@ -54,10 +68,28 @@ static void print_usage(const char *prog_name) {
     printf("\nOptions:\n");
     printf("  -i, --iterations N    Number of iterations (default: %d)\n", DEFAULT_ITERATIONS);
     printf("  -w, --warmup N        Number of warmup iterations (default: %d)\n", DEFAULT_WARMUP_ITERATIONS);
+    printf("  -W, --adaptive-warmup Warm up until the rolling-window median\n");
+    printf("                        stabilizes, instead of a fixed -w count\n");
     printf("  -r, --remove-outliers Remove statistical outliers\n");
     printf("  -v, --verbose         Verbose logging\n");
+    printf("  -p, --parallel N      Run with N parallel workers (default: sequential)\n");
     printf("  -j, --json FILE       Save results to JSON file\n");
     printf("  -c, --csv FILE        Save results to CSV file\n");
+    printf("  -d, --dump-samples DIR  Dump raw timing samples as binary files in DIR\n");
+    printf("  -k, --corpus DIR      Use (and build) a keypair corpus cache in DIR\n");
+    printf("  -e, --perf            Sample hardware counters (cycles, IPC, cache misses)\n");
+    printf("  -a, --adaptive REL    Adaptive sampling: stop at relative CI half-width REL\n");
+    printf("                        (e.g. 0.01 for ±1%%); -i becomes the minimum\n");
+    printf("  -m, --max-iterations N  Iteration cap in adaptive mode (default: 100000)\n");
+    printf("  -C, --cold            Cold-cache mode: evict the working set before each sample\n");
+    printf("  -x, --pin-cpu N       Pin the measurement thread to core N\n");
+    printf("  -t, --telemetry       Sample core frequency and temperature during runs\n");
+    printf("  -K, --checkpoint DIR  Checkpoint samples to spill files in DIR; an\n");
+    printf("                        interrupted run resumes from the last marker\n");
+    printf("  -B, --baseline DIR    Gate against a baseline sample dump (from -d):\n");
+    printf("                        exit 2 when an operation's median regresses\n");
+    printf("  -T, --threshold REL   Median slowdown that fails the -B gate\n");
+    printf("                        (default: 0.05 = 5%%)\n");
     printf("  -h, --help            Show this help message\n");
     printf("\nExamples:\n");
     printf("  %s -i 10000 -r\n", prog_name);
@@ -68,11 +100,24 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
     // Initialize defaults
     config->iterations = DEFAULT_ITERATIONS;
     config->warmup = DEFAULT_WARMUP_ITERATIONS;
+    config->adaptive_warmup = 0;
     config->remove_outliers = 0;
     config->verbose = 0;
+    config->parallel = 0;
     config->output_json = NULL;
     config->output_csv = NULL;
-    
+    config->sample_dir = NULL;
+    config->corpus_dir = NULL;
+    config->perf_counters = 0;
+    config->adaptive_ci = 0.0;
+    config->max_iterations = 0;
+    config->cold_cache = 0;
+    config->pin_cpu = -1;
+    config->telemetry = 0;
+    config->checkpoint_dir = NULL;
+    config->baseline_dir = NULL;
+    config->regression_threshold = 0.05;
+
     // Parse arguments
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "--iterations") == 0) {
@@ -83,10 +128,16 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
             if (++i < argc) {
                 config->warmup = atoi(argv[i]);
             }
+        } else if (strcmp(argv[i], "-W") == 0 || strcmp(argv[i], "--adaptive-warmup") == 0) {
+            config->adaptive_warmup = 1;
         } else if (strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--remove-outliers") == 0) {
             config->remove_outliers = 1;
         } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
             config->verbose = 1;
+        } else if (strcmp(argv[i], "-p") == 0 || strcmp(argv[i], "--parallel") == 0) {
+            if (++i < argc) {
+                config->parallel = atoi(argv[i]);
+            }
         } else if (strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--json") == 0) {
             if (++i < argc) {
                 config->output_json = argv[i];
@@ -95,6 +146,44 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
             if (++i < argc) {
                 config->output_csv = argv[i];
             }
+        } else if (strcmp(argv[i], "-d") == 0 || strcmp(argv[i], "--dump-samples") == 0) {
+            if (++i < argc) {
+                config->sample_dir = argv[i];
+            }
+        } else if (strcmp(argv[i], "-k") == 0 || strcmp(argv[i], "--corpus") == 0) {
+            if (++i < argc) {
+                config->corpus_dir = argv[i];
+            }
+        } else if (strcmp(argv[i], "-e") == 0 || strcmp(argv[i], "--perf") == 0) {
+            config->perf_counters = 1;
+        } else if (strcmp(argv[i], "-a") == 0 || strcmp(argv[i], "--adaptive") == 0) {
+            if (++i < argc) {
+                config->adaptive_ci = atof(argv[i]);
+            }
+        } else if (strcmp(argv[i], "-m") == 0 || strcmp(argv[i], "--max-iterations") == 0) {
+            if (++i < argc) {
+                config->max_iterations = atoi(argv[i]);
+            }
+        } else if (strcmp(argv[i], "-C") == 0 || strcmp(argv[i], "--cold") == 0) {
+            config->cold_cache = 1;
+        } else if (strcmp(argv[i], "-x") == 0 || strcmp(argv[i], "--pin-cpu") == 0) {
+            if (++i < argc) {
+                config->pin_cpu = atoi(argv[i]);
+            }
+        } else if (strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--telemetry") == 0) {
+            config->telemetry = 1;
+        } else if (strcmp(argv[i], "-K") == 0 || strcmp(argv[i], "--checkpoint") == 0) {
+            if (++i < argc) {
+                config->checkpoint_dir = argv[i];
+            }
+        } else if (strcmp(argv[i], "-B") == 0 || strcmp(argv[i], "--baseline") == 0) {
+            if (++i < argc) {
+                config->baseline_dir = argv[i];
+            }
+        } else if (strcmp(argv[i], "-T") == 0 || strcmp(argv[i], "--threshold") == 0) {
+            if (++i < argc) {
+                config->regression_threshold = atof(argv[i]);
+            }
         } else if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
             print_usage(argv[0]);
             exit(0);
@@ -102,6 +191,74 @@ static void parse_args(int argc, char *argv[], cli_config_t *config) {
     }
 }
 
+// ============================================================================
+// Result Output Helpers
+// ============================================================================
+
+/**
+ * @brief Build per-algorithm output path and write results in one format
+ *
+ * Inserts the algorithm name into the user-supplied path so each algorithm
+ * gets its own file (e.g., "results/out.json" -> "results/mlkem512_out.json").
+ */
+static int write_output_file(const char *base_path, const char *alg_name,
+                             const BenchmarkResultSet *results, int as_json) {
+    char out_path[512];
+    const char *last_slash = strrchr(base_path, '/');
+    const char *last_dot = strrchr(base_path, '.');
+
+    if (last_slash && last_dot && last_dot > last_slash) {
+        // Extract directory, base name, and extension
+        size_t dir_len = last_slash - base_path + 1;
+        size_t base_len = last_dot - last_slash - 1;
+
+        char dir[256];
+        char base[128];
+        const char *ext = last_dot;
+
+        strncpy(dir, base_path, dir_len);
+        dir[dir_len] = '\0';
+
+        strncpy(base, last_slash + 1, base_len);
+        base[base_len] = '\0';
+
+        snprintf(out_path, sizeof(out_path), "%s%s_%s%s", dir, alg_name, base, ext);
+    } else {
+        // Fallback: prepend algorithm name
+        snprintf(out_path, sizeof(out_path), "%s_%s", alg_name, base_path);
+    }
+
+    int ret = as_json ? pqc_benchmark_write_json(results, out_path)
+                      : pqc_benchmark_write_csv(results, out_path);
+    if (ret != 0) {
+        LOG_ERROR("Failed to write %s results", as_json ? "JSON" : "CSV");
+    } else {
+        LOG_INFO("Wrote %s results to %s", as_json ? "JSON" : "CSV", out_path);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Print and persist results for one algorithm according to CLI config
+ */
+static void output_results(const cli_config_t *cli_config, const char *alg_name,
+                           const BenchmarkResultSet *results) {
+    pqc_benchmark_print_results(results);
+
+    if (cli_config->output_json) {
+        write_output_file(cli_config->output_json, alg_name, results, 1);
+    }
+
+    if (cli_config->output_csv) {
+        write_output_file(cli_config->output_csv, alg_name, results, 0);
+    }
+
+    if (cli_config->sample_dir) {
+        pqc_benchmark_write_samples(results, cli_config->sample_dir);
+    }
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -116,6 +273,12 @@ int main(int argc, char *argv[]) {
         .include_source_info = 0
     };
     logger_init(log_config);
+
+    // Async logging keeps I/O off the measurement path; logger_close()
+    // drains the ring on every exit below
+    if (logger_async_start() != 0) {
+        LOG_WARN("Async logger unavailable, falling back to synchronous logging");
+    }
     
     // Parse command-line arguments
     cli_config_t cli_config;
@@ -132,8 +295,9 @@ int main(int argc, char *argv[]) {
     LOG_INFO("Remove outliers: %s", cli_config.remove_outliers ? "yes" : "no");
     LOG_INFO("======================================");
     
-    // Create liboqs provider
+    // Create liboqs provider and install its direct measurement kernels
     PQCProvider *provider = create_liboqs_provider();
+    liboqs_register_direct_loops();
     if (!provider) {
         LOG_ERROR("Failed to create liboqs provider");
         logger_close();
@@ -156,9 +320,96 @@ int main(int argc, char *argv[]) {
     bench_config.verbose = cli_config.verbose;
     bench_config.remove_outliers = cli_config.remove_outliers;
     bench_config.outlier_threshold = OUTLIER_MULTIPLIER;
-    
+    bench_config.parallel_workers = cli_config.parallel;
+    bench_config.corpus_dir = cli_config.corpus_dir;
+    bench_config.perf_counters = (cli_config.perf_counters != 0);
+    bench_config.cold_cache = (cli_config.cold_cache != 0);
+    bench_config.pin_cpu = cli_config.pin_cpu;
+    bench_config.cpu_telemetry = (cli_config.telemetry != 0);
+    bench_config.adaptive_warmup = (cli_config.adaptive_warmup != 0);
+    bench_config.checkpoint_dir = cli_config.checkpoint_dir;
+    bench_config.baseline_dir = cli_config.baseline_dir;
+    if (cli_config.regression_threshold > 0.0) {
+        bench_config.regression_threshold = cli_config.regression_threshold;
+    }
+    if (cli_config.adaptive_ci > 0.0) {
+        bench_config.adaptive_sampling = true;
+        bench_config.ci_target = cli_config.adaptive_ci;
+        if (cli_config.max_iterations > 0) {
+            bench_config.max_iterations = cli_config.max_iterations;
+        }
+    }
+
+    // Parallel mode: fan all (algorithm, operation) pairs out to a worker pool
+    if (cli_config.parallel > 1) {
+        LOG_INFO("Running in parallel mode with %d workers", cli_config.parallel);
+
+        const PQCAlgorithm *algs[NUM_ALGORITHMS];
+        int num_created = 0;
+        int failures = 0;
+
+        for (int i = 0; i < NUM_ALGORITHMS; i++) {
+            PQCAlgorithm *alg = provider->create_algorithm(provider, provider_ctx,
+                                                           MLKEM_ALGORITHMS[i]);
+            if (!alg) {
+                LOG_ERROR("Failed to create algorithm: %s", MLKEM_ALGORITHMS[i]);
+                failures++;
+                continue;
+            }
+            algs[num_created++] = alg;
+        }
+
+        BenchmarkResultSet **result_sets = NULL;
+        int regressions = 0;
+        int ret = 0;
+        if (num_created > 0) {
+            ret = pqc_benchmark_algorithms_parallel(algs, num_created,
+                                                    &bench_config, &result_sets);
+        }
+
+        if (ret != 0 || !result_sets) {
+            LOG_ERROR("Parallel benchmark campaign failed");
+            failures += num_created;
+        } else {
+            for (int i = 0; i < num_created; i++) {
+                output_results(&cli_config, algs[i]->name, result_sets[i]);
+                int reg = pqc_benchmark_result_set_regressions(result_sets[i]);
+                if (reg > 0) {
+                    regressions += reg;
+                }
+                pqc_benchmark_result_set_free(result_sets[i]);
+            }
+            free(result_sets);
+        }
+
+        for (int i = 0; i < num_created; i++) {
+            provider->destroy_algorithm(provider, provider_ctx,
+                                        (PQCAlgorithm*)algs[i]);
+        }
+
+        provider->cleanup(provider, provider_ctx);
+
+        if (regressions > 0) {
+            LOG_ERROR("%d operation(s) regressed beyond %.0f%% of baseline",
+                      regressions, bench_config.regression_threshold * 100.0);
+            logger_close();
+            return 2;
+        }
+
+        if (failures == 0) {
+            LOG_INFO("All benchmarks completed successfully");
+            logger_close();
+            return 0;
+        } else {
+            LOG_ERROR("%d benchmark(s) failed", failures);
+            logger_close();
+            return 1;
+        }
+    }
+
     // Run benchmarks for all algorithms
     int failures = 0;
+    int regressions = 0;
     for (int i = 0; i < NUM_ALGORITHMS; i++) {
         const char *alg_name = MLKEM_ALGORITHMS[i];
         
@@ -192,82 +443,14 @@ int main(int argc, char *argv[]) {
             continue;
         }
         
-        // Print results
-        pqc_benchmark_print_results(results);
-        
-        // Save results if requested
-        if (cli_config.output_json) {
-            char json_path[512];
-            // Generate unique filename per algorithm
-            const char *base_path = cli_config.output_json;
-            const char *last_slash = strrchr(base_path, '/');
-            const char *last_dot = strrchr(base_path, '.');
-            
-            if (last_slash && last_dot && last_dot > last_slash) {
-                // Extract directory, base name, and extension
-                size_t dir_len = last_slash - base_path + 1;
-                size_t base_len = last_dot - last_slash - 1;
-                
-                char dir[256];
-                char base[128];
-                const char *ext = last_dot;
-                
-                strncpy(dir, base_path, dir_len);
-                dir[dir_len] = '\0';
-                
-                strncpy(base, last_slash + 1, base_len);
-                base[base_len] = '\0';
-                
-                snprintf(json_path, sizeof(json_path), "%s%s_%s%s", dir, alg_name, base, ext);
-            } else {
-                // Fallback: prepend algorithm name
-                snprintf(json_path, sizeof(json_path), "%s_%s", alg_name, base_path);
-            }
-            
-            ret = pqc_benchmark_write_json(results, json_path);
-            if (ret != 0) {
-                LOG_ERROR("Failed to write JSON results");
-            } else {
-                LOG_INFO("Wrote JSON results to %s", json_path);
-            }
-        }
-        
-        if (cli_config.output_csv) {
-            char csv_path[512];
-            // Generate unique filename per algorithm
-            const char *base_path = cli_config.output_csv;
-            const char *last_slash = strrchr(base_path, '/');
-            const char *last_dot = strrchr(base_path, '.');
-            
-            if (last_slash && last_dot && last_dot > last_slash) {
-                // Extract directory, base name, and extension
-                size_t dir_len = last_slash - base_path + 1;
-                size_t base_len = last_dot - last_slash - 1;
-                
-                char dir[256];
-                char base[128];
-                const char *ext = last_dot;
-                
-                strncpy(dir, base_path, dir_len);
-                dir[dir_len] = '\0';
-                
-                strncpy(base, last_slash + 1, base_len);
-                base[base_len] = '\0';
-                
-                snprintf(csv_path, sizeof(csv_path), "%s%s_%s%s", dir, alg_name, base, ext);
-            } else {
-                // Fallback: prepend algorithm name
-                snprintf(csv_path, sizeof(csv_path), "%s_%s", alg_name, base_path);
-            }
-            
-            ret = pqc_benchmark_write_csv(results, csv_path);
-            if (ret != 0) {
-                LOG_ERROR("Failed to write CSV results");
-            } else {
-                LOG_INFO("Wrote CSV results to %s", csv_path);
-            }
+        // Print and save results
+        output_results(&cli_config, alg_name, results);
+
+        int reg = pqc_benchmark_result_set_regressions(results);
+        if (reg > 0) {
+            regressions += reg;
         }
-        
+
         // Cleanup
         pqc_benchmark_result_set_free(results);
         provider->destroy_algorithm(provider, provider_ctx, alg);
@@ -278,6 +461,15 @@ int main(int argc, char *argv[]) {
     // Cleanup provider
     provider->cleanup(provider, provider_ctx);
     
+    // Regression gate: distinct exit code so CI can tell "benchmark broke"
+    // from "benchmark ran fine but got slower"
+    if (regressions > 0) {
+        LOG_ERROR("%d operation(s) regressed beyond %.0f%% of baseline",
+                  regressions, bench_config.regression_threshold * 100.0);
+        logger_close();
+        return 2;
+    }
+
     // Summary
     if (failures == 0) {
         LOG_INFO("All benchmarks completed successfully");
@@ -9,6 +9,8 @@
  * between algorithm-specific benchmarks.
  */
 
+#define _GNU_SOURCE  // For pthread_setaffinity_np()
+
 #include "generic_benchmark.h"
 #include "../core/benchmark_engine.h"
 #include "../core/algorithm_interface.h"
@@ -16,9 +18,21 @@
 #include "../utils/timing.h"
 #include "../utils/stats.h"
 #include "../utils/logger.h"
+#include "../utils/arena.h"
+#include "../utils/perf_counters.h"
+#include "../utils/cpu_telemetry.h"
+#include "keypair_corpus.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 // ============================================================================
 // Configuration Functions
@@ -36,6 +50,28 @@ void pqc_benchmark_config_init(BenchmarkConfig *config) {
     config->verbose = false;
     config->remove_outliers = false;
     config->outlier_threshold = 1.5;
+    config->parallel_workers = 0;
+    config->measure_mode = PQC_MEASURE_MODE_LATENCY;
+    config->batch_size = 64;
+    config->timing_backend = PQC_TIMING_BACKEND_MONOTONIC;
+    config->streaming_stats = false;
+    config->corpus_dir = NULL;
+    config->perf_counters = false;
+    config->adaptive_sampling = false;
+    config->ci_target = 0.01;
+    config->max_iterations = 100000;
+    config->message_sizes = NULL;
+    config->num_message_sizes = 0;
+    config->cold_cache = false;
+    config->pin_cpu = -1;
+    config->cpu_telemetry = false;
+    config->freq_tolerance = 0.05;
+    config->checkpoint_dir = NULL;
+    config->checkpoint_interval = 1000;
+    config->baseline_dir = NULL;
+    config->regression_threshold = 0.05;
+    config->result_stream = NULL;
+    config->adaptive_warmup = false;
 }
 
 int pqc_benchmark_config_validate(const BenchmarkConfig *config) {
@@ -63,7 +99,43 @@ int pqc_benchmark_config_validate(const BenchmarkConfig *config) {
         LOG_ERROR("Invalid outlier_threshold: %.2f", config->outlier_threshold);
         return PQC_ERROR_INVALID_PARAM;
     }
-    
+
+    if (config->parallel_workers < 0) {
+        LOG_ERROR("Invalid parallel_workers: %d", config->parallel_workers);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    if (config->measure_mode == PQC_MEASURE_MODE_THROUGHPUT && config->batch_size <= 0) {
+        LOG_ERROR("Invalid batch_size: %d", config->batch_size);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    if (config->adaptive_sampling) {
+        if (config->ci_target <= 0.0) {
+            LOG_ERROR("Invalid ci_target: %.4f", config->ci_target);
+            return PQC_ERROR_INVALID_PARAM;
+        }
+        if (config->max_iterations < config->num_iterations) {
+            LOG_ERROR("max_iterations (%d) below num_iterations (%d)",
+                      config->max_iterations, config->num_iterations);
+            return PQC_ERROR_INVALID_PARAM;
+        }
+    }
+
+    if (config->num_message_sizes > 0) {
+        if (config->message_sizes == NULL) {
+            LOG_ERROR("message_sizes is NULL with num_message_sizes %d",
+                      config->num_message_sizes);
+            return PQC_ERROR_NULL_POINTER;
+        }
+        for (int i = 0; i < config->num_message_sizes; i++) {
+            if (config->message_sizes[i] == 0) {
+                LOG_ERROR("Invalid message size at index %d", i);
+                return PQC_ERROR_INVALID_PARAM;
+            }
+        }
+    }
+
     return PQC_SUCCESS;
 }
 
@@ -80,7 +152,7 @@ BenchmarkResult* pqc_benchmark_result_alloc(const char *algorithm,
         return NULL;
     }
     
-    if (num_samples <= 0) {
+    if (num_samples < 0) {
         LOG_ERROR("Invalid num_samples: %d", num_samples);
         return NULL;
     }
@@ -102,15 +174,18 @@ BenchmarkResult* pqc_benchmark_result_alloc(const char *algorithm,
         return NULL;
     }
     
-    result->samples = (uint64_t*)calloc(num_samples, sizeof(uint64_t));
-    if (result->samples == NULL) {
-        LOG_ERROR("Failed to allocate samples array");
-        pqc_benchmark_result_free(result);
-        return NULL;
+    // num_samples == 0: streaming mode retains no per-sample storage
+    if (num_samples > 0) {
+        result->samples = (uint64_t*)calloc(num_samples, sizeof(uint64_t));
+        if (result->samples == NULL) {
+            LOG_ERROR("Failed to allocate samples array");
+            pqc_benchmark_result_free(result);
+            return NULL;
+        }
     }
-    
+
     result->num_samples = num_samples;
-    
+
     return result;
 }
 
@@ -186,6 +261,22 @@ void pqc_benchmark_result_set_free(BenchmarkResultSet *result_set) {
     free(result_set);
 }
 
+int pqc_benchmark_result_set_regressions(const BenchmarkResultSet *result_set) {
+    if (result_set == NULL) {
+        LOG_ERROR("Result set is NULL");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    int regressions = 0;
+    for (int i = 0; i < result_set->num_results; i++) {
+        if (result_set->results[i].regressed) {
+            regressions++;
+        }
+    }
+
+    return regressions;
+}
+
 int pqc_benchmark_result_compute_stats(BenchmarkResult *result) {
     if (result == NULL) {
         LOG_ERROR("Result is NULL");
@@ -213,481 +304,2891 @@ int pqc_benchmark_result_compute_stats(BenchmarkResult *result) {
 }
 
 // ============================================================================
-// Benchmark Operation Helpers
+// Measurement Loop
 // ============================================================================
 
 /**
- * @brief Benchmark key generation operation
+ * @brief Operation callback invoked once per measured call
+ * @param op_ctx Opaque context owning the operation's buffers
+ * @return 0 on success, nonzero on failure
  */
-static int benchmark_keygen(const PQCAlgorithm *alg, 
-                           const BenchmarkConfig *config,
-                           BenchmarkResult *result) {
-    if (alg->keygen == NULL) {
-        LOG_ERROR("Algorithm does not support keygen");
-        return PQC_ERROR_NOT_SUPPORTED;
+typedef int (*benchmark_op_fn)(void *op_ctx);
+
+/**
+ * @brief Shared buffer context for the benchmark operation callbacks
+ *
+ * Each benchmark helper fills in the fields its operation needs and leaves
+ * the rest NULL.
+ */
+typedef struct {
+    const PQCAlgorithm *alg;   ///< Algorithm under test
+    uint8_t *pk;               ///< Public key buffer
+    uint8_t *sk;               ///< Secret key buffer
+    uint8_t *ct;               ///< Ciphertext buffer (KEM)
+    uint8_t *ss;               ///< Shared secret buffer (KEM)
+    uint8_t *ss_dec;           ///< Decapsulated shared secret buffer (KEM)
+    uint8_t *sig;              ///< Signature buffer (Signature)
+    size_t sig_actual_len;     ///< Length of the signature produced during setup
+    const uint8_t *msg;        ///< Message to sign/verify (Signature)
+    size_t msg_len;            ///< Message length (Signature)
+
+    // Batch verification corpus (verify_batch only)
+    const uint8_t **batch_msgs; ///< Distinct messages, one per pair
+    uint8_t **batch_sigs;       ///< Matching signatures
+    size_t *batch_sig_lens;     ///< Actual signature lengths
+    int batch_count;            ///< Number of (message, signature) pairs
+    int batch_index;            ///< Next pair to verify (round-robin)
+} op_context_t;
+
+static int op_keygen(void *p) {
+    op_context_t *c = (op_context_t*)p;
+    return c->alg->keygen(c->alg, c->pk, c->sk);
+}
+
+static int op_encaps(void *p) {
+    op_context_t *c = (op_context_t*)p;
+    return c->alg->encaps(c->alg, c->ct, c->ss, c->pk);
+}
+
+static int op_decaps(void *p) {
+    op_context_t *c = (op_context_t*)p;
+    return c->alg->decaps(c->alg, c->ss_dec, c->ct, c->sk);
+}
+
+static int op_handshake(void *p) {
+    op_context_t *c = (op_context_t*)p;
+
+    // Full KEM round-trip: fresh keypair, encapsulate, decapsulate. The
+    // ciphertext handoff stays in cache between the two sides, matching
+    // the composed handshake path rather than a single op in a self-loop.
+    int ret = c->alg->keygen(c->alg, c->pk, c->sk);
+    if (ret != 0) {
+        return ret;
     }
-    
-    // Allocate buffers
-    uint8_t *pk = (uint8_t*)malloc(alg->pk_len);
-    uint8_t *sk = (uint8_t*)malloc(alg->sk_len);
-    
-    if (pk == NULL || sk == NULL) {
-        LOG_ERROR("Failed to allocate key buffers");
-        free(pk);
-        free(sk);
-        return PQC_ERROR_MEMORY_ALLOC;
+
+    ret = c->alg->encaps(c->alg, c->ct, c->ss, c->pk);
+    if (ret != 0) {
+        return ret;
     }
-    
-    // Warmup
-    if (config->warmup_iterations > 0) {
-        LOG_DEBUG("Warmup: %d iterations", config->warmup_iterations);
-        for (int i = 0; i < config->warmup_iterations; i++) {
-            alg->keygen(alg, pk, sk);
-        }
+
+    ret = c->alg->decaps(c->alg, c->ss_dec, c->ct, c->sk);
+    if (ret != 0) {
+        return ret;
     }
-    
-    // Benchmark iterations
-    LOG_DEBUG("Benchmarking keygen: %d iterations", config->num_iterations);
-    for (int i = 0; i < config->num_iterations; i++) {
-        pqc_timestamp_t start = pqc_timestamp_now();
-        int ret = alg->keygen(alg, pk, sk);
-        pqc_timestamp_t end = pqc_timestamp_now();
-        
-        if (ret != 0) {
-            LOG_ERROR("Keygen failed at iteration %d", i);
-            free(pk);
-            free(sk);
-            return PQC_ERROR_OPERATION_FAILED;
+
+    // Shared-secret agreement is part of the contract being measured
+    if (memcmp(c->ss, c->ss_dec, c->alg->ss_len) != 0) {
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    return 0;
+}
+
+static int op_sign(void *p) {
+    op_context_t *c = (op_context_t*)p;
+    size_t sig_len = c->alg->sig_len;
+    return c->alg->sign(c->alg, c->sig, &sig_len, c->msg, c->msg_len, c->sk);
+}
+
+static int op_verify(void *p) {
+    op_context_t *c = (op_context_t*)p;
+    return c->alg->verify(c->alg, c->msg, c->msg_len, c->sig,
+                          c->sig_actual_len, c->pk);
+}
+
+static int op_verify_batch(void *p) {
+    op_context_t *c = (op_context_t*)p;
+
+    // Round-robin over the pre-generated pairs; one timed batch covers
+    // the whole corpus once, all against the same public key
+    int i = c->batch_index;
+    c->batch_index = (i + 1 == c->batch_count) ? 0 : i + 1;
+
+    return c->alg->verify(c->alg, c->batch_msgs[i], c->msg_len,
+                          c->batch_sigs[i], c->batch_sig_lens[i], c->pk);
+}
+
+// ============================================================================
+// Direct Kernel Registry
+// ============================================================================
+
+// Enough for every (algorithm, operation) pair the adapters specialize,
+// with headroom for providers registering their own kernels
+#define PQC_DIRECT_REGISTRY_CAPACITY 64
+
+typedef struct {
+    const char *algorithm;         ///< Algorithm name (not owned)
+    const char *operation;         ///< Operation name (not owned)
+    pqc_direct_loop_fn fn;         ///< Monomorphized timed batch
+} direct_loop_entry_t;
+
+static direct_loop_entry_t direct_registry[PQC_DIRECT_REGISTRY_CAPACITY];
+static int num_direct_loops = 0;
+
+int pqc_benchmark_register_direct_loop(const char *algorithm,
+                                       const char *operation,
+                                       pqc_direct_loop_fn fn) {
+    if (algorithm == NULL || operation == NULL) {
+        LOG_ERROR("NULL name in register_direct_loop");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    for (int i = 0; i < num_direct_loops; i++) {
+        if (strcmp(direct_registry[i].algorithm, algorithm) == 0 &&
+            strcmp(direct_registry[i].operation, operation) == 0) {
+            if (fn == NULL) {
+                // Remove by swapping in the last entry
+                direct_registry[i] = direct_registry[--num_direct_loops];
+            } else {
+                direct_registry[i].fn = fn;
+            }
+            return PQC_SUCCESS;
         }
-        
-        result->samples[i] = pqc_timestamp_diff(start, end);
     }
-    
-    free(pk);
-    free(sk);
-    
+
+    if (fn == NULL) {
+        return PQC_SUCCESS;
+    }
+    if (num_direct_loops >= PQC_DIRECT_REGISTRY_CAPACITY) {
+        LOG_ERROR("Direct kernel registry full (%d entries)",
+                  PQC_DIRECT_REGISTRY_CAPACITY);
+        return PQC_ERROR_INVALID_STATE;
+    }
+
+    direct_registry[num_direct_loops].algorithm = algorithm;
+    direct_registry[num_direct_loops].operation = operation;
+    direct_registry[num_direct_loops].fn = fn;
+    num_direct_loops++;
     return PQC_SUCCESS;
 }
 
+static pqc_direct_loop_fn find_direct_loop(const char *algorithm,
+                                           const char *operation) {
+    for (int i = 0; i < num_direct_loops; i++) {
+        if (strcmp(direct_registry[i].algorithm, algorithm) == 0 &&
+            strcmp(direct_registry[i].operation, operation) == 0) {
+            return direct_registry[i].fn;
+        }
+    }
+    return NULL;
+}
+
+// ============================================================================
+// Cold-Cache Eviction
+// ============================================================================
+
+// Cache-line granularity assumed by the flush loop; 64 bytes on every
+// supported target (x86_64, Cortex-A72, typical RV64 SoCs)
+#define PQC_CACHE_LINE_SIZE 64
+
+// Fallback eviction buffer, sized past the LLC on every supported board
+// (largest is 32 MiB on the x86_64 baseline hosts)
+#define PQC_COLD_EVICT_BUFFER_SIZE (64u * 1024u * 1024u)
+
+#if defined(__x86_64__) || defined(__amd64__)
+#define PQC_HAVE_CACHE_FLUSH 1
+static inline void pqc_flush_line(const void *p) {
+    __asm__ volatile("clflush (%0)" :: "r"(p) : "memory");
+}
+#elif defined(__aarch64__)
+#define PQC_HAVE_CACHE_FLUSH 1
+static inline void pqc_flush_line(const void *p) {
+    // Requires SCTLR_EL1.UCI, which Linux enables for EL0
+    __asm__ volatile("dc civac, %0" :: "r"(p) : "memory");
+}
+#else
+// RV64GC has no user-space cache maintenance; rely on the eviction buffer
+#define PQC_HAVE_CACHE_FLUSH 0
+#endif
+
+#if PQC_HAVE_CACHE_FLUSH
 /**
- * @brief Benchmark encapsulation operation (KEM only)
+ * @brief Flush every cache line of a buffer back to memory
  */
-static int benchmark_encaps(const PQCAlgorithm *alg,
-                           const BenchmarkConfig *config,
-                           BenchmarkResult *result) {
-    if (alg->encaps == NULL) {
-        LOG_ERROR("Algorithm does not support encaps");
-        return PQC_ERROR_NOT_SUPPORTED;
-    }
-    
-    // Allocate buffers
-    uint8_t *pk = (uint8_t*)malloc(alg->pk_len);
-    uint8_t *sk = (uint8_t*)malloc(alg->sk_len);
-    uint8_t *ct = (uint8_t*)malloc(alg->ct_len);
-    uint8_t *ss = (uint8_t*)malloc(alg->ss_len);
-    
-    if (pk == NULL || sk == NULL || ct == NULL || ss == NULL) {
-        LOG_ERROR("Failed to allocate buffers");
-        free(pk); free(sk); free(ct); free(ss);
-        return PQC_ERROR_MEMORY_ALLOC;
+static void flush_buffer(const uint8_t *buf, size_t len) {
+    if (buf == NULL || len == 0) {
+        return;
     }
-    
-    // Generate keypair for testing
-    if (alg->keygen(alg, pk, sk) != 0) {
-        LOG_ERROR("Keygen failed during encaps setup");
-        free(pk); free(sk); free(ct); free(ss);
-        return PQC_ERROR_OPERATION_FAILED;
+    for (size_t off = 0; off < len; off += PQC_CACHE_LINE_SIZE) {
+        pqc_flush_line(buf + off);
     }
-    
-    // Warmup
-    if (config->warmup_iterations > 0) {
-        LOG_DEBUG("Warmup: %d iterations", config->warmup_iterations);
-        for (int i = 0; i < config->warmup_iterations; i++) {
-            alg->encaps(alg, ct, ss, pk);
-        }
+}
+#endif
+
+/**
+ * @brief Evict the operation's working set from the cache hierarchy
+ * @param ctx Buffer context of the operation being measured
+ * @param evict_buf Fallback eviction buffer, or NULL when line flushes work
+ *
+ * With cache-line flush instructions available (x86_64 clflush, AArch64
+ * dc civac) only the operation's own buffers are flushed, leaving the
+ * rest of the cache intact. Without them the fallback streams a write
+ * pass through a buffer larger than the LLC, displacing the working set
+ * along with everything else — coarser, but the only option from user
+ * space on RISC-V.
+ */
+static void evict_working_set(const op_context_t *ctx, uint8_t *evict_buf) {
+#if PQC_HAVE_CACHE_FLUSH
+    if (evict_buf == NULL) {
+        const PQCAlgorithm *alg = ctx->alg;
+        flush_buffer(ctx->pk, alg->pk_len);
+        flush_buffer(ctx->sk, alg->sk_len);
+        flush_buffer(ctx->ct, alg->ct_len);
+        flush_buffer(ctx->ss, alg->ss_len);
+        flush_buffer(ctx->ss_dec, alg->ss_len);
+        flush_buffer(ctx->sig, alg->sig_len);
+        flush_buffer(ctx->msg, ctx->msg_len);
+        __sync_synchronize();
+        return;
     }
-    
-    // Benchmark iterations
-    LOG_DEBUG("Benchmarking encaps: %d iterations", config->num_iterations);
-    for (int i = 0; i < config->num_iterations; i++) {
-        pqc_timestamp_t start = pqc_timestamp_now();
-        int ret = alg->encaps(alg, ct, ss, pk);
-        pqc_timestamp_t end = pqc_timestamp_now();
-        
-        if (ret != 0) {
-            LOG_ERROR("Encaps failed at iteration %d", i);
-            free(pk); free(sk); free(ct); free(ss);
-            return PQC_ERROR_OPERATION_FAILED;
+#else
+    (void)ctx;
+#endif
+
+    if (evict_buf != NULL) {
+        for (size_t off = 0; off < PQC_COLD_EVICT_BUFFER_SIZE;
+             off += PQC_CACHE_LINE_SIZE) {
+            evict_buf[off]++;
         }
-        
-        result->samples[i] = pqc_timestamp_diff(start, end);
+        __sync_synchronize();
     }
-    
-    free(pk); free(sk); free(ct); free(ss);
-    
-    return PQC_SUCCESS;
 }
 
+// Adaptive mode re-checks convergence once per this many iterations, so
+// the check itself stays off the measured path almost entirely
+#define PQC_ADAPTIVE_CHECK_INTERVAL 100
+
 /**
- * @brief Benchmark decapsulation operation (KEM only)
+ * @brief Relative 95% CI half-width on the mean of a streaming accumulator
+ * @param stream Accumulator observed so far
+ * @return Relative half-width, or -1.0 while too few samples to estimate
+ *
+ * Uses the normal approximation (z = 1.96), which is accurate at the
+ * sample counts where adaptive stopping is allowed to trigger. The mean
+ * is the convergence proxy; the reported median still comes from the P²
+ * estimator as usual.
  */
-static int benchmark_decaps(const PQCAlgorithm *alg,
-                           const BenchmarkConfig *config,
-                           BenchmarkResult *result) {
-    if (alg->decaps == NULL) {
-        LOG_ERROR("Algorithm does not support decaps");
-        return PQC_ERROR_NOT_SUPPORTED;
+static double stream_ci_half_width_rel(const pqc_stream_stats_t *stream) {
+    if (stream->count < 2 || stream->mean <= 0.0) {
+        return -1.0;
     }
-    
-    // Allocate buffers
-    uint8_t *pk = (uint8_t*)malloc(alg->pk_len);
-    uint8_t *sk = (uint8_t*)malloc(alg->sk_len);
-    uint8_t *ct = (uint8_t*)malloc(alg->ct_len);
-    uint8_t *ss = (uint8_t*)malloc(alg->ss_len);
-    uint8_t *ss_dec = (uint8_t*)malloc(alg->ss_len);
-    
-    if (pk == NULL || sk == NULL || ct == NULL || ss == NULL || ss_dec == NULL) {
-        LOG_ERROR("Failed to allocate buffers");
-        free(pk); free(sk); free(ct); free(ss); free(ss_dec);
-        return PQC_ERROR_MEMORY_ALLOC;
-    }
-    
-    // Generate keypair and ciphertext for testing
-    if (alg->keygen(alg, pk, sk) != 0) {
-        LOG_ERROR("Keygen failed during decaps setup");
-        free(pk); free(sk); free(ct); free(ss); free(ss_dec);
-        return PQC_ERROR_OPERATION_FAILED;
+
+    double n = (double)stream->count;
+    double stddev = sqrt(stream->m2 / (n - 1.0));
+    double half_width = 1.96 * stddev / sqrt(n);
+
+    return half_width / stream->mean;
+}
+
+// ============================================================================
+// Checkpoint Spill Files
+// ============================================================================
+
+/**
+ * @brief Open spill file and append cursor of a checkpointed run
+ */
+typedef struct {
+    int fd;                          ///< Open spill file descriptor
+    char path[512];                  ///< Spill file path (for unlink on completion)
+    pqc_checkpoint_header_t header;  ///< In-memory header, rewritten at markers
+    int pending;                     ///< Samples appended since the last marker
+    int interval;                    ///< Samples between fsync'd markers
+} checkpoint_state_t;
+
+/**
+ * @brief Build the spill file path for one (algorithm, operation) run
+ *
+ * Message-size sweeps produce several results under the same operation
+ * name, so the swept size is part of the filename.
+ */
+static void checkpoint_build_path(char *buf, size_t size, const char *dir,
+                                  const BenchmarkResult *result,
+                                  const char *op_name) {
+    if (result->message_len > 0) {
+        snprintf(buf, size, "%s/%s_%s_%s_msg%zu.ckpt", dir,
+                 result->algorithm, op_name, result->architecture,
+                 result->message_len);
+    } else {
+        snprintf(buf, size, "%s/%s_%s_%s.ckpt", dir,
+                 result->algorithm, op_name, result->architecture);
     }
-    
-    if (alg->encaps(alg, ct, ss, pk) != 0) {
-        LOG_ERROR("Encaps failed during decaps setup");
-        free(pk); free(sk); free(ct); free(ss); free(ss_dec);
-        return PQC_ERROR_OPERATION_FAILED;
+}
+
+/**
+ * @brief Write an fsync'd progress marker
+ *
+ * The sample column is made durable before the header that covers it, so
+ * committed_samples never points past data that survived a crash.
+ */
+static int checkpoint_commit(checkpoint_state_t *ckpt) {
+    if (fdatasync(ckpt->fd) != 0) {
+        return PQC_ERROR_IO;
     }
-    
-    // Warmup
-    if (config->warmup_iterations > 0) {
-        LOG_DEBUG("Warmup: %d iterations", config->warmup_iterations);
-        for (int i = 0; i < config->warmup_iterations; i++) {
-            alg->decaps(alg, ss_dec, ct, sk);
-        }
+    if (pwrite(ckpt->fd, &ckpt->header, sizeof(ckpt->header), 0) !=
+        (ssize_t)sizeof(ckpt->header)) {
+        return PQC_ERROR_IO;
     }
-    
-    // Benchmark iterations
-    LOG_DEBUG("Benchmarking decaps: %d iterations", config->num_iterations);
-    for (int i = 0; i < config->num_iterations; i++) {
-        pqc_timestamp_t start = pqc_timestamp_now();
-        int ret = alg->decaps(alg, ss_dec, ct, sk);
-        pqc_timestamp_t end = pqc_timestamp_now();
-        
-        if (ret != 0) {
-            LOG_ERROR("Decaps failed at iteration %d", i);
-            free(pk); free(sk); free(ct); free(ss); free(ss_dec);
-            return PQC_ERROR_OPERATION_FAILED;
-        }
-        
-        result->samples[i] = pqc_timestamp_diff(start, end);
+    if (fdatasync(ckpt->fd) != 0) {
+        return PQC_ERROR_IO;
     }
-    
-    free(pk); free(sk); free(ct); free(ss); free(ss_dec);
-    
     return PQC_SUCCESS;
 }
 
 /**
- * @brief Benchmark signing operation (Signature only)
+ * @brief Open (and possibly resume from) the spill file for one run
+ * @param config Benchmark configuration (checkpoint_dir must be set)
+ * @param result Result whose sample array receives reloaded samples
+ * @param op_name Operation name
+ * @param target_iterations Samples the full run will produce
+ * @param batch Operations per timed batch
+ * @param ckpt Checkpoint state to initialize
+ * @param resume_from Output: completed samples reloaded from the file
+ * @return 0 on success, negative error code otherwise
+ *
+ * A matching spill file resumes the run: the durable sample prefix is
+ * copied into result->samples and the file is truncated back to the last
+ * marker, so at most one checkpoint interval of work is repeated. A file
+ * written under a different configuration is discarded with a warning.
  */
-static int benchmark_sign(const PQCAlgorithm *alg,
-                         const BenchmarkConfig *config,
-                         BenchmarkResult *result) {
-    if (alg->sign == NULL) {
-        LOG_ERROR("Algorithm does not support sign");
-        return PQC_ERROR_NOT_SUPPORTED;
-    }
-    
-    // Allocate buffers
-    uint8_t *pk = (uint8_t*)malloc(alg->pk_len);
-    uint8_t *sk = (uint8_t*)malloc(alg->sk_len);
-    uint8_t *sig = (uint8_t*)malloc(alg->sig_len);
-    
-    // Test message
-    const char *msg = "Test message for signing";
-    size_t msg_len = strlen(msg);
-    
-    if (pk == NULL || sk == NULL || sig == NULL) {
-        LOG_ERROR("Failed to allocate buffers");
-        free(pk); free(sk); free(sig);
-        return PQC_ERROR_MEMORY_ALLOC;
+static int checkpoint_open(const BenchmarkConfig *config,
+                           BenchmarkResult *result,
+                           const char *op_name,
+                           int target_iterations,
+                           int batch,
+                           checkpoint_state_t *ckpt,
+                           int *resume_from) {
+    *resume_from = 0;
+
+    checkpoint_build_path(ckpt->path, sizeof(ckpt->path),
+                          config->checkpoint_dir, result, op_name);
+
+    ckpt->fd = open(ckpt->path, O_RDWR | O_CREAT, 0644);
+    if (ckpt->fd < 0) {
+        LOG_WARN("Cannot open checkpoint file %s, checkpointing disabled",
+                 ckpt->path);
+        return PQC_ERROR_IO;
     }
-    
-    // Generate keypair for testing
-    if (alg->keygen(alg, pk, sk) != 0) {
-        LOG_ERROR("Keygen failed during sign setup");
-        free(pk); free(sk); free(sig);
-        return PQC_ERROR_OPERATION_FAILED;
+    ckpt->pending = 0;
+    ckpt->interval = (config->checkpoint_interval > 0)
+                         ? config->checkpoint_interval : 1000;
+
+    // An existing file only resumes this run if its fingerprint matches;
+    // mixing settings would blend incomparable samples into one result
+    pqc_checkpoint_header_t on_disk;
+    ssize_t n = read(ckpt->fd, &on_disk, sizeof(on_disk));
+    bool resumable =
+        (n == (ssize_t)sizeof(on_disk) &&
+         memcmp(on_disk.magic, PQC_CHECKPOINT_FILE_MAGIC,
+                sizeof(on_disk.magic)) == 0 &&
+         on_disk.header_size == (uint32_t)sizeof(on_disk) &&
+         on_disk.sample_width == (uint32_t)sizeof(uint64_t) &&
+         on_disk.target_samples == (uint64_t)target_iterations &&
+         on_disk.batch_size == (uint32_t)batch &&
+         on_disk.cold_cache == (uint32_t)(config->cold_cache ? 1 : 0) &&
+         on_disk.message_len == (uint64_t)result->message_len &&
+         strncmp(on_disk.algorithm, result->algorithm,
+                 sizeof(on_disk.algorithm)) == 0 &&
+         strncmp(on_disk.operation, op_name,
+                 sizeof(on_disk.operation)) == 0);
+    if (n > 0 && !resumable) {
+        LOG_WARN("%s: checkpoint %s does not match this run, starting over",
+                 op_name, ckpt->path);
     }
-    
-    // Warmup
-    if (config->warmup_iterations > 0) {
-        LOG_DEBUG("Warmup: %d iterations", config->warmup_iterations);
-        for (int i = 0; i < config->warmup_iterations; i++) {
-            size_t sig_len = alg->sig_len;
-            alg->sign(alg, sig, &sig_len, (const uint8_t*)msg, msg_len, sk);
+
+    memset(&ckpt->header, 0, sizeof(ckpt->header));
+    memcpy(ckpt->header.magic, PQC_CHECKPOINT_FILE_MAGIC,
+           sizeof(ckpt->header.magic));
+    ckpt->header.header_size = (uint32_t)sizeof(ckpt->header);
+    ckpt->header.sample_width = (uint32_t)sizeof(uint64_t);
+    ckpt->header.target_samples = (uint64_t)target_iterations;
+    ckpt->header.batch_size = (uint32_t)batch;
+    ckpt->header.cold_cache = (uint32_t)(config->cold_cache ? 1 : 0);
+    ckpt->header.message_len = (uint64_t)result->message_len;
+    snprintf(ckpt->header.algorithm, sizeof(ckpt->header.algorithm), "%s",
+             result->algorithm);
+    snprintf(ckpt->header.operation, sizeof(ckpt->header.operation), "%s",
+             op_name);
+    snprintf(ckpt->header.architecture, sizeof(ckpt->header.architecture),
+             "%s", result->architecture);
+
+    if (resumable && on_disk.committed_samples > 0) {
+        uint64_t committed = on_disk.committed_samples;
+        if (committed > (uint64_t)target_iterations) {
+            committed = (uint64_t)target_iterations;
         }
-    }
-    
-    // Benchmark iterations
-    LOG_DEBUG("Benchmarking sign: %d iterations", config->num_iterations);
-    for (int i = 0; i < config->num_iterations; i++) {
-        size_t sig_len = alg->sig_len;
-        
-        pqc_timestamp_t start = pqc_timestamp_now();
-        int ret = alg->sign(alg, sig, &sig_len, (const uint8_t*)msg, msg_len, sk);
-        pqc_timestamp_t end = pqc_timestamp_now();
-        
-        if (ret != 0) {
-            LOG_ERROR("Sign failed at iteration %d", i);
-            free(pk); free(sk); free(sig);
-            return PQC_ERROR_OPERATION_FAILED;
+
+        ssize_t want = (ssize_t)(committed * sizeof(uint64_t));
+        ssize_t got = pread(ckpt->fd, result->samples, (size_t)want,
+                            (off_t)sizeof(on_disk));
+        if (got != want) {
+            // Trust only the samples actually present on disk
+            committed = (got > 0) ? (uint64_t)got / sizeof(uint64_t) : 0;
         }
-        
-        result->samples[i] = pqc_timestamp_diff(start, end);
+
+        ckpt->header.committed_samples = committed;
+        *resume_from = (int)committed;
     }
-    
-    free(pk); free(sk); free(sig);
-    
+
+    // Discard anything past the durable prefix and re-mark
+    off_t data_end = (off_t)sizeof(ckpt->header) +
+                     (off_t)(ckpt->header.committed_samples * sizeof(uint64_t));
+    if (ftruncate(ckpt->fd, data_end) != 0 ||
+        lseek(ckpt->fd, data_end, SEEK_SET) < 0 ||
+        checkpoint_commit(ckpt) != PQC_SUCCESS) {
+        LOG_WARN("Cannot initialize checkpoint file %s, checkpointing disabled",
+                 ckpt->path);
+        close(ckpt->fd);
+        *resume_from = 0;
+        return PQC_ERROR_IO;
+    }
+
     return PQC_SUCCESS;
 }
 
 /**
- * @brief Benchmark verification operation (Signature only)
+ * @brief Append one sample to the spill file, marking every interval
  */
-static int benchmark_verify(const PQCAlgorithm *alg,
-                           const BenchmarkConfig *config,
-                           BenchmarkResult *result) {
-    if (alg->verify == NULL) {
-        LOG_ERROR("Algorithm does not support verify");
-        return PQC_ERROR_NOT_SUPPORTED;
-    }
-    
-    // Allocate buffers
-    uint8_t *pk = (uint8_t*)malloc(alg->pk_len);
-    uint8_t *sk = (uint8_t*)malloc(alg->sk_len);
-    uint8_t *sig = (uint8_t*)malloc(alg->sig_len);
-    
-    // Test message
-    const char *msg = "Test message for signing";
-    size_t msg_len = strlen(msg);
-    size_t sig_len = alg->sig_len;
-    
-    if (pk == NULL || sk == NULL || sig == NULL) {
-        LOG_ERROR("Failed to allocate buffers");
-        free(pk); free(sk); free(sig);
-        return PQC_ERROR_MEMORY_ALLOC;
-    }
-    
-    // Generate keypair and signature for testing
-    if (alg->keygen(alg, pk, sk) != 0) {
-        LOG_ERROR("Keygen failed during verify setup");
-        free(pk); free(sk); free(sig);
-        return PQC_ERROR_OPERATION_FAILED;
+static int checkpoint_append(checkpoint_state_t *ckpt, uint64_t sample) {
+    if (write(ckpt->fd, &sample, sizeof(sample)) !=
+        (ssize_t)sizeof(sample)) {
+        return PQC_ERROR_IO;
     }
-    
-    if (alg->sign(alg, sig, &sig_len, (const uint8_t*)msg, msg_len, sk) != 0) {
-        LOG_ERROR("Sign failed during verify setup");
-        free(pk); free(sk); free(sig);
-        return PQC_ERROR_OPERATION_FAILED;
+
+    ckpt->pending++;
+    if (ckpt->pending >= ckpt->interval) {
+        ckpt->header.committed_samples += (uint64_t)ckpt->pending;
+        ckpt->pending = 0;
+        return checkpoint_commit(ckpt);
     }
-    
-    // Warmup
-    if (config->warmup_iterations > 0) {
-        LOG_DEBUG("Warmup: %d iterations", config->warmup_iterations);
-        for (int i = 0; i < config->warmup_iterations; i++) {
-            alg->verify(alg, (const uint8_t*)msg, msg_len, sig, sig_len, pk);
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Close the spill file, unlinking it once the run completed
+ *
+ * An incomplete run (operation failure) keeps the file with a final
+ * marker so a later invocation still resumes from it.
+ */
+static void checkpoint_close(checkpoint_state_t *ckpt, bool completed) {
+    if (completed) {
+        close(ckpt->fd);
+        unlink(ckpt->path);
+        return;
+    }
+
+    ckpt->header.committed_samples += (uint64_t)ckpt->pending;
+    ckpt->pending = 0;
+    checkpoint_commit(ckpt);
+    close(ckpt->fd);
+}
+
+// Defined with the parallel scheduling helpers below; the measurement loop
+// also pins when config->pin_cpu is set
+static void pin_thread_to_cpu(int cpu);
+
+// ============================================================================
+// Warmup Phase
+// ============================================================================
+
+// Adaptive warmup compares medians of adjacent windows of this many timed
+// iterations; small enough that convergence is detected within tens of
+// iterations on a settled machine
+#define PQC_WARMUP_WINDOW 16
+
+// Adjacent window medians within this relative tolerance count as stable
+#define PQC_WARMUP_TOLERANCE 0.02
+
+// Consecutive stable window comparisons required to declare convergence,
+// so a single quiet window during a downward trend does not end warmup
+#define PQC_WARMUP_STABLE_WINDOWS 2
+
+// Iteration cap for adaptive warmup; platforms that have not settled by
+// here get a warning rather than an unbounded warmup phase
+#define PQC_WARMUP_MAX_ITERATIONS 5000
+
+/**
+ * @brief Median of a small sample window (insertion sort on a copy)
+ */
+static uint64_t warmup_window_median(const uint64_t *window, int n) {
+    uint64_t sorted[PQC_WARMUP_WINDOW];
+    for (int i = 0; i < n; i++) {
+        uint64_t v = window[i];
+        int j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
         }
+        sorted[j] = v;
     }
-    
-    // Benchmark iterations
-    LOG_DEBUG("Benchmarking verify: %d iterations", config->num_iterations);
-    for (int i = 0; i < config->num_iterations; i++) {
+    return sorted[n / 2];
+}
+
+/**
+ * @brief Run the warmup phase for one operation
+ * @param op_name Operation name (for logging)
+ * @param config Benchmark configuration
+ * @param op Operation callback
+ * @param op_ctx Context passed to the operation callback
+ * @param converged Output: whether adaptive warmup detected convergence
+ *                  (false in fixed mode; may be NULL)
+ * @return Number of warmup iterations executed
+ *
+ * Fixed mode runs exactly config->warmup_iterations calls. Adaptive mode
+ * times each warmup call and stops once the medians of
+ * PQC_WARMUP_STABLE_WINDOWS consecutive adjacent windows agree within
+ * PQC_WARMUP_TOLERANCE, so fast-settling platforms stop after a few dozen
+ * iterations while slow-settling ones keep warming up to the
+ * PQC_WARMUP_MAX_ITERATIONS cap. Operation failures are ignored here,
+ * as in the measured loop's warmup before it: the measured iterations
+ * report them with full context.
+ */
+static int run_warmup(const char *op_name, const BenchmarkConfig *config,
+                      benchmark_op_fn op, void *op_ctx, bool *converged) {
+    if (converged != NULL) {
+        *converged = false;
+    }
+
+    if (!config->adaptive_warmup) {
+        if (config->warmup_iterations > 0) {
+            LOG_DEBUG("%s warmup: %d iterations (fixed)",
+                      op_name, config->warmup_iterations);
+            for (int i = 0; i < config->warmup_iterations; i++) {
+                op(op_ctx);
+            }
+        }
+        return config->warmup_iterations > 0 ? config->warmup_iterations : 0;
+    }
+
+    uint64_t window[PQC_WARMUP_WINDOW];
+    uint64_t prev_median = 0;
+    int filled = 0;
+    int stable = 0;
+    int iterations = 0;
+
+    while (iterations < PQC_WARMUP_MAX_ITERATIONS) {
         pqc_timestamp_t start = pqc_timestamp_now();
-        int ret = alg->verify(alg, (const uint8_t*)msg, msg_len, sig, sig_len, pk);
+        op(op_ctx);
         pqc_timestamp_t end = pqc_timestamp_now();
-        
+        window[filled++] = pqc_timestamp_diff(start, end);
+        iterations++;
+
+        if (filled < PQC_WARMUP_WINDOW) {
+            continue;
+        }
+        filled = 0;
+
+        uint64_t median = warmup_window_median(window, PQC_WARMUP_WINDOW);
+        if (prev_median > 0) {
+            double delta = (double)median - (double)prev_median;
+            if (delta < 0.0) {
+                delta = -delta;
+            }
+            if (delta <= PQC_WARMUP_TOLERANCE * (double)prev_median) {
+                stable++;
+            } else {
+                stable = 0;
+            }
+        }
+        prev_median = median;
+
+        if (stable >= PQC_WARMUP_STABLE_WINDOWS) {
+            LOG_DEBUG("%s warmup converged after %d iterations "
+                      "(window median %llu ns)",
+                      op_name, iterations, (unsigned long long)median);
+            if (converged != NULL) {
+                *converged = true;
+            }
+            return iterations;
+        }
+    }
+
+    LOG_WARN("%s warmup hit the %d-iteration cap without the window "
+             "median stabilizing within %.0f%%; early samples may still "
+             "trend",
+             op_name, PQC_WARMUP_MAX_ITERATIONS,
+             PQC_WARMUP_TOLERANCE * 100.0);
+    return iterations;
+}
+
+/**
+ * @brief Run warmup and measurement iterations for one operation
+ * @param op_name Operation name (for logging)
+ * @param config Benchmark configuration
+ * @param result Result to fill with timing samples
+ * @param op Operation callback
+ * @param op_ctx Context passed to the operation callback
+ * @return 0 on success, negative error code on failure
+ *
+ * In latency mode each iteration times a single call. In throughput mode
+ * each iteration times a batch of config->batch_size back-to-back calls
+ * and stores the amortized per-operation time as the sample, so clock-read
+ * overhead is spread over the whole batch. Sustained throughput metrics
+ * are accumulated over the full run in both modes.
+ *
+ * Cold-cache mode evicts the operation's working set before every timed
+ * sample (op_ctx must be an op_context_t, which every internal caller
+ * passes). Warmup still runs so code paths and branch predictors settle;
+ * only the data working set is cold.
+ *
+ * With config->checkpoint_dir set, samples are spilled append-only to a
+ * per-operation file with fsync'd progress markers; an interrupted run
+ * resumes from the last marker on the next invocation, bounding crash
+ * rework to one checkpoint interval. The file is removed on completion.
+ */
+static int run_measurement_loop(const char *op_name,
+                                const BenchmarkConfig *config,
+                                BenchmarkResult *result,
+                                benchmark_op_fn op,
+                                void *op_ctx) {
+    // Pin before warmup so the frequency governor and caches settle on the
+    // core the samples will be taken on
+    if (config->pin_cpu >= 0) {
+        pin_thread_to_cpu(config->pin_cpu);
+    }
+
+    // Warmup: fixed count, or run-until-stable with adaptive_warmup
+    bool warmup_converged = false;
+    result->warmup_iterations_used =
+        run_warmup(op_name, config, op, op_ctx, &warmup_converged);
+    result->warmup_converged = warmup_converged;
+
+    int batch = 1;
+    if (config->measure_mode == PQC_MEASURE_MODE_THROUGHPUT) {
+        batch = config->batch_size;
+    }
+
+    // Cold-cache regime: eviction happens outside the timed region
+    uint8_t *evict_buf = NULL;
+    if (config->cold_cache) {
+        result->cold_cache = true;
+        if (batch > 1) {
+            LOG_WARN("%s: cold-cache mode evicts once per batch; operations "
+                     "after the first run warm", op_name);
+        }
+#if !PQC_HAVE_CACHE_FLUSH
+        evict_buf = (uint8_t*)calloc(1, PQC_COLD_EVICT_BUFFER_SIZE);
+        if (evict_buf == NULL) {
+            LOG_ERROR("Failed to allocate cold-cache eviction buffer");
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+#endif
+    }
+
+    // Adaptive mode runs at least num_iterations, then keeps going until
+    // the CI target is met or max_iterations is hit
+    int target_iterations = config->num_iterations;
+    if (config->adaptive_sampling) {
+        target_iterations = config->max_iterations;
+    }
+
+    // Checkpointed runs spill samples append-only and resume after a
+    // crash; streaming modes retain no samples to reload, so they run
+    // without crash recovery
+    checkpoint_state_t ckpt;
+    bool ckpt_on = false;
+    int resume_from = 0;
+    if (config->checkpoint_dir != NULL) {
+        if (config->streaming_stats || config->adaptive_sampling) {
+            LOG_WARN("%s: checkpointing requires retained samples, disabled "
+                     "for streaming/adaptive runs", op_name);
+        } else if (checkpoint_open(config, result, op_name, target_iterations,
+                                   batch, &ckpt, &resume_from) == PQC_SUCCESS) {
+            ckpt_on = true;
+            if (resume_from > 0) {
+                LOG_INFO("%s: resumed from checkpoint with %d/%d samples",
+                         op_name, resume_from, target_iterations);
+            }
+        }
+    }
+
+    // Benchmark iterations
+    LOG_DEBUG("Benchmarking %s: %d iterations (batch=%d)",
+              op_name, target_iterations, batch);
+
+    // Monomorphized path: a registered direct kernel replaces the timed
+    // batch, so the measured window holds direct calls instead of the
+    // PQCAlgorithm and adapter indirections. Everything outside the window
+    // (eviction, statistics, counters, checkpoints) is unchanged.
+    const op_context_t *octx = (const op_context_t*)op_ctx;
+    pqc_direct_loop_fn direct_fn = NULL;
+    pqc_direct_buffers_t direct_buf;
+    if (octx->alg != NULL && octx->alg->name != NULL) {
+        direct_fn = find_direct_loop(octx->alg->name, op_name);
+    }
+    if (direct_fn != NULL) {
+        direct_buf.pk = octx->pk;
+        direct_buf.sk = octx->sk;
+        direct_buf.ct = octx->ct;
+        direct_buf.ss = octx->ss;
+        direct_buf.ss_dec = octx->ss_dec;
+        direct_buf.sig = octx->sig;
+        direct_buf.sig_cap = octx->alg->sig_len;
+        direct_buf.sig_actual_len = octx->sig_actual_len;
+        direct_buf.msg = octx->msg;
+        direct_buf.msg_len = octx->msg_len;
+        LOG_DEBUG("%s/%s: using monomorphized measurement kernel",
+                  octx->alg->name, op_name);
+    }
+
+    // Streaming mode: feed samples into an online accumulator instead of
+    // retaining them, so long runs need O(1) memory. Adaptive sampling
+    // needs the accumulator for its convergence checks, so it implies
+    // streaming regardless of the config flag.
+    pqc_stream_stats_t stream;
+    bool streaming = config->streaming_stats || config->adaptive_sampling;
+    if (streaming) {
+        pqc_stream_stats_init(&stream);
+    }
+
+    pqc_histogram_init(&result->histogram);
+
+    // Hardware counters bracket the measured iterations only, never the
+    // warmup; degrade to timing-only when no PMU is available
+    pqc_perf_group_t perf;
+    bool perf_on = false;
+    if (config->perf_counters) {
+        perf_on = (pqc_perf_open(&perf) == PQC_SUCCESS);
+    }
+
+    // Frequency/thermal sampler runs alongside the measured iterations
+    // only; when the sysfs interfaces are absent the result stays untagged
+    pqc_cpu_telemetry_t telemetry;
+    bool telemetry_on = false;
+    if (config->cpu_telemetry) {
+        int monitored_cpu = (config->pin_cpu >= 0) ? config->pin_cpu : 0;
+        telemetry_on = (pqc_cpu_telemetry_start(&telemetry, monitored_cpu,
+                                                0) == PQC_SUCCESS);
+    }
+
+    uint64_t total_ns = 0;
+
+    // Replay reloaded samples so the histogram, tail percentiles and
+    // throughput metrics cover the whole run, not just this session
+    for (int i = 0; i < resume_from; i++) {
+        pqc_histogram_record(&result->histogram, result->samples[i]);
+        total_ns += result->samples[i] * (uint64_t)batch;
+    }
+
+    if (perf_on) {
+        pqc_perf_start(&perf);
+    }
+
+    int iterations_run = resume_from;
+
+    for (int i = resume_from; i < target_iterations; i++) {
+        if (config->cold_cache) {
+            evict_working_set((const op_context_t*)op_ctx, evict_buf);
+        }
+
+        int ret = 0;
+        uint64_t elapsed = 0;
+        if (direct_fn != NULL) {
+            ret = direct_fn(&direct_buf, batch, &elapsed);
+        } else {
+            pqc_timestamp_t start = pqc_timestamp_now();
+            for (int b = 0; b < batch; b++) {
+                ret = op(op_ctx);
+                if (ret != 0) {
+                    break;
+                }
+            }
+            pqc_timestamp_t end = pqc_timestamp_now();
+            elapsed = pqc_timestamp_diff(start, end);
+        }
         if (ret != 0) {
-            LOG_ERROR("Verify failed at iteration %d", i);
-            free(pk); free(sk); free(sig);
+            LOG_ERROR("%s failed at iteration %d", op_name, i);
+            if (perf_on) {
+                pqc_perf_close(&perf);
+            }
+            if (telemetry_on) {
+                pqc_cpu_telemetry_stop(&telemetry);
+            }
+            if (ckpt_on) {
+                checkpoint_close(&ckpt, false);
+            }
+            free(evict_buf);
             return PQC_ERROR_OPERATION_FAILED;
         }
-        
-        result->samples[i] = pqc_timestamp_diff(start, end);
+        total_ns += elapsed;
+
+        uint64_t per_op_ns = elapsed / (uint64_t)batch;
+        pqc_histogram_record(&result->histogram, per_op_ns);
+        if (streaming) {
+            pqc_stream_stats_update(&stream, per_op_ns);
+        } else {
+            result->samples[i] = per_op_ns;
+        }
+
+        if (ckpt_on && checkpoint_append(&ckpt, per_op_ns) != PQC_SUCCESS) {
+            LOG_WARN("%s: checkpoint write failed, continuing without "
+                     "crash recovery", op_name);
+            checkpoint_close(&ckpt, false);
+            ckpt_on = false;
+        }
+
+        iterations_run = i + 1;
+
+        if (config->adaptive_sampling &&
+            iterations_run >= config->num_iterations &&
+            iterations_run % PQC_ADAPTIVE_CHECK_INTERVAL == 0) {
+            double rel = stream_ci_half_width_rel(&stream);
+            if (rel >= 0.0 && rel <= config->ci_target) {
+                result->ci_converged = true;
+                result->ci_half_width_rel = rel;
+                LOG_DEBUG("%s converged after %d iterations "
+                          "(CI half-width %.3f%% of mean)",
+                          op_name, iterations_run, rel * 100.0);
+                break;
+            }
+        }
     }
-    
-    free(pk); free(sk); free(sig);
-    
+
+    if (config->adaptive_sampling && !result->ci_converged) {
+        double rel = stream_ci_half_width_rel(&stream);
+        if (rel >= 0.0) {
+            result->ci_half_width_rel = rel;
+        }
+        LOG_WARN("%s hit the %d-iteration cap without reaching the "
+                 "±%.2f%% CI target (got ±%.2f%%)",
+                 op_name, config->max_iterations,
+                 config->ci_target * 100.0, result->ci_half_width_rel * 100.0);
+    }
+
+    if (ckpt_on) {
+        checkpoint_close(&ckpt, true);
+    }
+
+    free(evict_buf);
+
+    if (telemetry_on) {
+        pqc_cpu_telemetry_stop(&telemetry);
+        if (telemetry.num_samples > 0) {
+            result->telemetry_valid = true;
+            result->freq_min_mhz = (double)telemetry.freq_min_khz / 1000.0;
+            result->freq_max_mhz = (double)telemetry.freq_max_khz / 1000.0;
+            if (telemetry.freq_sum_khz > 0.0) {
+                result->freq_mean_mhz = telemetry.freq_sum_khz /
+                    (double)telemetry.num_samples / 1000.0;
+            }
+            result->temp_max_c = (double)telemetry.temp_max_mc / 1000.0;
+
+            double span = pqc_cpu_telemetry_freq_span(&telemetry);
+            if (span > config->freq_tolerance) {
+                result->freq_throttled = true;
+                LOG_WARN("%s: core frequency moved %.1f%% during the run "
+                         "(%.0f-%.0f MHz), samples may mix clock regimes",
+                         op_name, span * 100.0,
+                         result->freq_min_mhz, result->freq_max_mhz);
+            }
+        }
+    }
+
+    uint64_t total_ops = (uint64_t)iterations_run * (uint64_t)batch;
+
+    // Hardware counters only saw this session's iterations, not any
+    // samples reloaded from a checkpoint
+    uint64_t session_ops =
+        (uint64_t)(iterations_run - resume_from) * (uint64_t)batch;
+
+    if (perf_on) {
+        pqc_perf_stop(&perf);
+
+        pqc_perf_counts_t counts;
+        if (pqc_perf_read(&perf, &counts) == PQC_SUCCESS && session_ops > 0) {
+            double ops = (double)session_ops;
+            uint64_t cycles = counts.value[PQC_PERF_CYCLES];
+            uint64_t instructions = counts.value[PQC_PERF_INSTRUCTIONS];
+
+            if (counts.valid[PQC_PERF_CYCLES]) {
+                result->cycles_per_op = (double)cycles / ops;
+            }
+            if (counts.valid[PQC_PERF_INSTRUCTIONS]) {
+                result->instructions_per_op = (double)instructions / ops;
+            }
+            if (counts.valid[PQC_PERF_CYCLES] &&
+                counts.valid[PQC_PERF_INSTRUCTIONS] && cycles > 0) {
+                result->ipc = (double)instructions / (double)cycles;
+            }
+            if (instructions > 0) {
+                double kilo_instr = (double)instructions / 1000.0;
+                if (counts.valid[PQC_PERF_L1D_MISSES]) {
+                    result->l1d_mpki =
+                        (double)counts.value[PQC_PERF_L1D_MISSES] / kilo_instr;
+                }
+                if (counts.valid[PQC_PERF_LLC_MISSES]) {
+                    result->llc_mpki =
+                        (double)counts.value[PQC_PERF_LLC_MISSES] / kilo_instr;
+                }
+                if (counts.valid[PQC_PERF_BRANCH_MISSES]) {
+                    result->branch_mpki =
+                        (double)counts.value[PQC_PERF_BRANCH_MISSES] / kilo_instr;
+                }
+            }
+
+            result->perf_valid = true;
+        }
+
+        pqc_perf_close(&perf);
+    }
+
+    // Tail percentiles come from the histogram in both modes
+    result->p999 = pqc_ns_to_us(
+        (pqc_time_ns_t)pqc_histogram_percentile(&result->histogram, 99.9));
+    result->p9999 = pqc_ns_to_us(
+        (pqc_time_ns_t)pqc_histogram_percentile(&result->histogram, 99.99));
+
+    if (streaming) {
+        // Summarize directly; there is no sample array to post-process
+        pqc_stats_t stats = pqc_stream_stats_finalize(&stream);
+        result->num_samples = (int)stats.n_samples;
+        result->mean = pqc_ns_to_us((pqc_time_ns_t)stats.mean);
+        result->median = pqc_ns_to_us((pqc_time_ns_t)stats.median);
+        result->std_dev = pqc_ns_to_us((pqc_time_ns_t)stats.stddev);
+        result->min = pqc_ns_to_us(stats.min);
+        result->max = pqc_ns_to_us(stats.max);
+        result->p95 = pqc_ns_to_us((pqc_time_ns_t)stats.p95);
+        result->p99 = pqc_ns_to_us((pqc_time_ns_t)stats.p99);
+    }
+
+    // Sustained throughput over the full measurement run
+    result->batch_size = batch;
+    if (total_ns > 0 && total_ops > 0) {
+        result->amortized_ns_op = (double)total_ns / (double)total_ops;
+        result->throughput_ops_sec = (double)total_ops / pqc_ns_to_s(total_ns);
+    }
+
     return PQC_SUCCESS;
 }
 
 // ============================================================================
-// Main Benchmark Functions
+// Benchmark Operation Helpers
 // ============================================================================
 
-int pqc_benchmark_operation(const PQCAlgorithm *alg,
-                           const char *operation,
-                           const BenchmarkConfig *config,
-                           BenchmarkResult **result) {
-    if (alg == NULL || operation == NULL || config == NULL || result == NULL) {
-        LOG_ERROR("NULL parameter in benchmark_operation");
-        return PQC_ERROR_NULL_POINTER;
+/**
+ * @brief Arena bytes covering every operation buffer of one algorithm
+ *
+ * Sized for the worst-case operation (decaps needs pk, sk, ct and two
+ * shared secrets; verify needs pk, sk and sig), with per-block alignment
+ * slack included. The message block covers the corpus message or, when a
+ * size sweep is configured, the largest swept message.
+ */
+static size_t arena_size_for_algorithm(const PQCAlgorithm *alg,
+                                       const BenchmarkConfig *config) {
+    size_t size = 0;
+
+    size += alg->pk_len + PQC_ARENA_ALIGNMENT;
+    size += alg->sk_len + PQC_ARENA_ALIGNMENT;
+    size += alg->ct_len + PQC_ARENA_ALIGNMENT;
+    size += 2 * (alg->ss_len + PQC_ARENA_ALIGNMENT);
+    size += alg->sig_len + PQC_ARENA_ALIGNMENT;
+
+    size_t msg_block = 64;
+    for (int i = 0; i < config->num_message_sizes; i++) {
+        if (config->message_sizes[i] > msg_block) {
+            msg_block = config->message_sizes[i];
+        }
     }
-    
-    // Validate algorithm
-    int ret = pqc_algorithm_validate(alg);
+    size += msg_block + PQC_ARENA_ALIGNMENT;
+
+    // verify_batch pre-generates batch_size (message, signature) pairs
+    // plus the arrays indexing them
+    if (pqc_algorithm_is_signature(alg) && config->batch_size > 0) {
+        size_t pairs = (size_t)config->batch_size;
+        size += pairs * (alg->sig_len + PQC_ARENA_ALIGNMENT);
+        size += pairs * (64 + PQC_ARENA_ALIGNMENT);
+        size += pairs * (2 * sizeof(void*) + sizeof(size_t)) +
+                3 * PQC_ARENA_ALIGNMENT;
+    }
+
+    return size;
+}
+
+/**
+ * @brief Fill an operation's setup material from the keypair corpus
+ * @param alg Algorithm under test
+ * @param config Benchmark configuration (corpus_dir selects the corpus)
+ * @param arena Arena used for the copied message block
+ * @param ctx Operation context whose carved buffers receive the material
+ * @return 0 if material was copied, negative error code otherwise
+ *
+ * Copies the corpus record into whichever buffers the context has carved
+ * (pk/sk/ct/ss/sig) and points the context at a copy of the corpus
+ * message for signature algorithms. Callers fall back to live keygen
+ * when this fails, so a missing or stale corpus degrades gracefully.
+ */
+static int corpus_setup(const PQCAlgorithm *alg, const BenchmarkConfig *config,
+                        pqc_arena_t *arena, op_context_t *ctx) {
+    if (config->corpus_dir == NULL) {
+        return PQC_ERROR_IO;
+    }
+
+    pqc_keypair_corpus_t corpus;
+    int ret = pqc_keypair_corpus_ensure(&corpus, alg, config->corpus_dir);
     if (ret != PQC_SUCCESS) {
-        LOG_ERROR("Algorithm validation failed");
+        LOG_WARN("Corpus unavailable for %s, using live setup", alg->name);
         return ret;
     }
-    
-    // Validate config
-    ret = pqc_benchmark_config_validate(config);
+
+    pqc_corpus_entry_t entry;
+    ret = pqc_keypair_corpus_entry(&corpus, 0, &entry);
     if (ret != PQC_SUCCESS) {
-        LOG_ERROR("Config validation failed");
+        pqc_keypair_corpus_close(&corpus);
         return ret;
     }
-    
-    // Get architecture
-    const char *arch = pqc_benchmark_get_architecture();
-    
-    // Allocate result
-    *result = pqc_benchmark_result_alloc(alg->name, operation, arch, 
-                                        config->num_iterations);
-    if (*result == NULL) {
-        LOG_ERROR("Failed to allocate result");
+
+    if (ctx->pk != NULL) {
+        memcpy(ctx->pk, entry.pk, alg->pk_len);
+    }
+    if (ctx->sk != NULL) {
+        memcpy(ctx->sk, entry.sk, alg->sk_len);
+    }
+    if (ctx->ct != NULL && entry.ct != NULL) {
+        memcpy(ctx->ct, entry.ct, alg->ct_len);
+    }
+    if (ctx->ss != NULL && entry.ss != NULL) {
+        memcpy(ctx->ss, entry.ss, alg->ss_len);
+    }
+    if (ctx->sig != NULL && entry.sig != NULL) {
+        memcpy(ctx->sig, entry.sig, entry.sig_len);
+        ctx->sig_actual_len = entry.sig_len;
+    }
+
+    if (entry.msg != NULL) {
+        // The signature is over the corpus message, so verify must use it
+        uint8_t *msg = (uint8_t*)pqc_arena_alloc(arena, entry.msg_len);
+        if (msg == NULL) {
+            pqc_keypair_corpus_close(&corpus);
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+        memcpy(msg, entry.msg, entry.msg_len);
+        ctx->msg = msg;
+        ctx->msg_len = entry.msg_len;
+    }
+
+    pqc_keypair_corpus_close(&corpus);
+
+    LOG_DEBUG("Setup material for %s drawn from corpus", alg->name);
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Prepare the context for key generation
+ */
+static int setup_keygen_context(const PQCAlgorithm *alg,
+                                pqc_arena_t *arena,
+                                op_context_t *ctx) {
+    if (alg->keygen == NULL) {
+        LOG_ERROR("Algorithm does not support keygen");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    // Carve buffers from the campaign arena
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+
+    if (pk == NULL || sk == NULL) {
         return PQC_ERROR_MEMORY_ALLOC;
     }
-    
-    // Dispatch to appropriate benchmark function
-    if (strcmp(operation, "keygen") == 0) {
-        ret = benchmark_keygen(alg, config, *result);
-    } else if (strcmp(operation, "encaps") == 0) {
-        ret = benchmark_encaps(alg, config, *result);
-    } else if (strcmp(operation, "decaps") == 0) {
-        ret = benchmark_decaps(alg, config, *result);
-    } else if (strcmp(operation, "sign") == 0) {
-        ret = benchmark_sign(alg, config, *result);
-    } else if (strcmp(operation, "verify") == 0) {
-        ret = benchmark_verify(alg, config, *result);
-    } else {
-        LOG_ERROR("Unknown operation: %s", operation);
-        pqc_benchmark_result_free(*result);
-        *result = NULL;
-        return PQC_ERROR_INVALID_PARAM;
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Prepare the context for encapsulation (KEM only)
+ */
+static int setup_encaps_context(const PQCAlgorithm *alg,
+                                const BenchmarkConfig *config,
+                                pqc_arena_t *arena,
+                                op_context_t *ctx) {
+    if (alg->encaps == NULL) {
+        LOG_ERROR("Algorithm does not support encaps");
+        return PQC_ERROR_NOT_SUPPORTED;
     }
-    
-    if (ret != PQC_SUCCESS) {
-        LOG_ERROR("Benchmark operation failed");
-        pqc_benchmark_result_free(*result);
-        *result = NULL;
-        return ret;
+
+    // Carve buffers from the campaign arena
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+    uint8_t *ct = (uint8_t*)pqc_arena_alloc(arena, alg->ct_len);
+    uint8_t *ss = (uint8_t*)pqc_arena_alloc(arena, alg->ss_len);
+
+    if (pk == NULL || sk == NULL || ct == NULL || ss == NULL) {
+        return PQC_ERROR_MEMORY_ALLOC;
     }
-    
-    // Remove outliers if requested
-    if (config->remove_outliers) {
-        size_t original_count = (*result)->num_samples;
-        size_t new_count = pqc_stats_remove_outliers((*result)->samples, 
-                                                     original_count,
-                                                     config->outlier_threshold);
-        (*result)->num_samples = new_count;
-        LOG_INFO("Removed %zu outliers from %s", 
-                 original_count - new_count, operation);
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+    ctx->ct = ct;
+    ctx->ss = ss;
+
+    // Draw the keypair from the corpus, or generate one live
+    if (corpus_setup(alg, config, arena, ctx) != PQC_SUCCESS) {
+        if (alg->keygen(alg, pk, sk) != 0) {
+            LOG_ERROR("Keygen failed during encaps setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
     }
-    
-    // Compute statistics
-    ret = pqc_benchmark_result_compute_stats(*result);
-    if (ret != PQC_SUCCESS) {
-        LOG_ERROR("Failed to compute statistics");
-        pqc_benchmark_result_free(*result);
-        *result = NULL;
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Prepare the context for decapsulation (KEM only)
+ */
+static int setup_decaps_context(const PQCAlgorithm *alg,
+                                const BenchmarkConfig *config,
+                                pqc_arena_t *arena,
+                                op_context_t *ctx) {
+    if (alg->decaps == NULL) {
+        LOG_ERROR("Algorithm does not support decaps");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    // Carve buffers from the campaign arena
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+    uint8_t *ct = (uint8_t*)pqc_arena_alloc(arena, alg->ct_len);
+    uint8_t *ss = (uint8_t*)pqc_arena_alloc(arena, alg->ss_len);
+    uint8_t *ss_dec = (uint8_t*)pqc_arena_alloc(arena, alg->ss_len);
+
+    if (pk == NULL || sk == NULL || ct == NULL || ss == NULL || ss_dec == NULL) {
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+    ctx->ct = ct;
+    ctx->ss = ss;
+    ctx->ss_dec = ss_dec;
+
+    // Draw the keypair and matching ciphertext from the corpus, or
+    // generate them live
+    if (corpus_setup(alg, config, arena, ctx) != PQC_SUCCESS) {
+        if (alg->keygen(alg, pk, sk) != 0) {
+            LOG_ERROR("Keygen failed during decaps setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+
+        if (alg->encaps(alg, ct, ss, pk) != 0) {
+            LOG_ERROR("Encaps failed during decaps setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+    }
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Prepare the context for the composed KEM handshake (KEM only)
+ *
+ * The handshake times the full keygen -> encaps -> decaps round-trip per
+ * iteration and validates shared-secret agreement inside the measured
+ * path. The reported throughput is handshakes/sec, which is the
+ * capacity-planning number; summing the three per-op means misestimates
+ * the tail because the composed path has different cache behavior than
+ * any single op.
+ */
+static int setup_handshake_context(const PQCAlgorithm *alg,
+                                   pqc_arena_t *arena,
+                                   op_context_t *ctx) {
+    if (alg->keygen == NULL || alg->encaps == NULL || alg->decaps == NULL) {
+        LOG_ERROR("Algorithm does not support the full KEM handshake");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    // Carve buffers from the campaign arena
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+    uint8_t *ct = (uint8_t*)pqc_arena_alloc(arena, alg->ct_len);
+    uint8_t *ss = (uint8_t*)pqc_arena_alloc(arena, alg->ss_len);
+    uint8_t *ss_dec = (uint8_t*)pqc_arena_alloc(arena, alg->ss_len);
+
+    if (pk == NULL || sk == NULL || ct == NULL || ss == NULL || ss_dec == NULL) {
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+    ctx->ct = ct;
+    ctx->ss = ss;
+    ctx->ss_dec = ss_dec;
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Carve and fill a swept message block of the requested size
+ * @param arena Arena to carve from
+ * @param msg_len Message size in bytes
+ * @return Pointer to the filled block, or NULL on exhaustion
+ *
+ * The deterministic byte pattern keeps sweep points reproducible across
+ * runs and architectures.
+ */
+static uint8_t* carve_sweep_message(pqc_arena_t *arena, size_t msg_len) {
+    uint8_t *msg = (uint8_t*)pqc_arena_alloc(arena, msg_len);
+    if (msg == NULL) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < msg_len; i++) {
+        msg[i] = (uint8_t)(i & 0xFF);
+    }
+
+    return msg;
+}
+
+/**
+ * @brief Prepare the context for signing (Signature only)
+ *
+ * sweep_msg_len > 0 selects a message-size sweep point: a deterministic
+ * message of that size replaces the default/corpus message.
+ */
+static int setup_sign_context(const PQCAlgorithm *alg,
+                              const BenchmarkConfig *config,
+                              pqc_arena_t *arena,
+                              size_t sweep_msg_len,
+                              op_context_t *ctx) {
+    if (alg->sign == NULL) {
+        LOG_ERROR("Algorithm does not support sign");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    // Carve buffers from the campaign arena
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+    uint8_t *sig = (uint8_t*)pqc_arena_alloc(arena, alg->sig_len);
+
+    // Test message
+    const char *msg = "Test message for signing";
+    size_t msg_len = strlen(msg);
+
+    if (pk == NULL || sk == NULL || sig == NULL) {
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+    ctx->sig = sig;
+    ctx->msg = (const uint8_t*)msg;
+    ctx->msg_len = msg_len;
+
+    // Draw the keypair from the corpus, or generate one live
+    if (corpus_setup(alg, config, arena, ctx) != PQC_SUCCESS) {
+        if (alg->keygen(alg, pk, sk) != 0) {
+            LOG_ERROR("Keygen failed during sign setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+    }
+
+    // A sweep point overrides whatever message the setup chose
+    if (sweep_msg_len > 0) {
+        uint8_t *sweep_msg = carve_sweep_message(arena, sweep_msg_len);
+        if (sweep_msg == NULL) {
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+        ctx->msg = sweep_msg;
+        ctx->msg_len = sweep_msg_len;
+    }
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Prepare the context for verification (Signature only)
+ *
+ * sweep_msg_len > 0 selects a message-size sweep point: the signature is
+ * recomputed live over a deterministic message of that size, since the
+ * corpus signature only covers the corpus message.
+ */
+static int setup_verify_context(const PQCAlgorithm *alg,
+                                const BenchmarkConfig *config,
+                                pqc_arena_t *arena,
+                                size_t sweep_msg_len,
+                                op_context_t *ctx) {
+    if (alg->verify == NULL) {
+        LOG_ERROR("Algorithm does not support verify");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    // Carve buffers from the campaign arena
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+    uint8_t *sig = (uint8_t*)pqc_arena_alloc(arena, alg->sig_len);
+
+    // Test message
+    const char *msg = "Test message for signing";
+    size_t msg_len = strlen(msg);
+    size_t sig_len = alg->sig_len;
+
+    if (pk == NULL || sk == NULL || sig == NULL) {
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+    ctx->sig = sig;
+    ctx->msg = (const uint8_t*)msg;
+    ctx->msg_len = msg_len;
+
+    // Draw the keypair and matching signature from the corpus, or
+    // generate them live
+    bool have_signature = false;
+    if (corpus_setup(alg, config, arena, ctx) == PQC_SUCCESS) {
+        have_signature = (ctx->sig_actual_len > 0);
+    } else {
+        if (alg->keygen(alg, pk, sk) != 0) {
+            LOG_ERROR("Keygen failed during verify setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+    }
+
+    // A sweep point overrides the message and invalidates any corpus
+    // signature, so the signature is recomputed over the swept message
+    if (sweep_msg_len > 0) {
+        uint8_t *sweep_msg = carve_sweep_message(arena, sweep_msg_len);
+        if (sweep_msg == NULL) {
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+        ctx->msg = sweep_msg;
+        ctx->msg_len = sweep_msg_len;
+        have_signature = false;
+    }
+
+    if (!have_signature) {
+        if (alg->sign(alg, sig, &sig_len, ctx->msg, ctx->msg_len, sk) != 0) {
+            LOG_ERROR("Sign failed during verify setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+
+        ctx->sig_actual_len = sig_len;
+    }
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Prepare the context for batch verification
+ *
+ * Pre-generates config->batch_size distinct (message, signature) pairs
+ * under one keypair, so the measured loop verifies the whole batch
+ * back-to-back against a single public key. That is the ingestion-path
+ * shape where per-key setup (public-key expansion, table residency)
+ * amortizes across signatures, which single-shot verify cannot show.
+ */
+static int setup_verify_batch_context(const PQCAlgorithm *alg,
+                                      const BenchmarkConfig *config,
+                                      pqc_arena_t *arena,
+                                      op_context_t *ctx) {
+    if (alg->verify == NULL || alg->sign == NULL) {
+        LOG_ERROR("Algorithm does not support verify");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    int count = config->batch_size;
+    const size_t msg_len = 24;
+
+    // Carve the keypair, the pair arrays, and the pair buffers
+    uint8_t *pk = (uint8_t*)pqc_arena_alloc(arena, alg->pk_len);
+    uint8_t *sk = (uint8_t*)pqc_arena_alloc(arena, alg->sk_len);
+    const uint8_t **msgs = (const uint8_t**)pqc_arena_alloc(
+        arena, (size_t)count * sizeof(uint8_t*));
+    uint8_t **sigs = (uint8_t**)pqc_arena_alloc(
+        arena, (size_t)count * sizeof(uint8_t*));
+    size_t *sig_lens = (size_t*)pqc_arena_alloc(
+        arena, (size_t)count * sizeof(size_t));
+    if (pk == NULL || sk == NULL || msgs == NULL || sigs == NULL ||
+        sig_lens == NULL) {
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    ctx->alg = alg;
+    ctx->pk = pk;
+    ctx->sk = sk;
+    ctx->msg_len = msg_len;
+    ctx->batch_msgs = msgs;
+    ctx->batch_sigs = sigs;
+    ctx->batch_sig_lens = sig_lens;
+    ctx->batch_count = count;
+    ctx->batch_index = 0;
+
+    // One keypair for the whole batch, from the corpus when available
+    if (corpus_setup(alg, config, arena, ctx) != PQC_SUCCESS) {
+        if (alg->keygen(alg, pk, sk) != 0) {
+            LOG_ERROR("Keygen failed during verify_batch setup");
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+    }
+    // The corpus message does not apply here; the pairs below carry
+    // their own messages of the default length
+    ctx->msg = NULL;
+    ctx->msg_len = msg_len;
+
+    // Distinct message contents so verification cannot ride on a shared
+    // message hash; each pair gets its own live signature
+    for (int i = 0; i < count; i++) {
+        uint8_t *msg = (uint8_t*)pqc_arena_alloc(arena, msg_len);
+        uint8_t *sig = (uint8_t*)pqc_arena_alloc(arena, alg->sig_len);
+        if (msg == NULL || sig == NULL) {
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+
+        for (size_t j = 0; j < msg_len; j++) {
+            msg[j] = (uint8_t)(i * 131 + (int)j * 31 + 7);
+        }
+
+        size_t sig_len = alg->sig_len;
+        if (alg->sign(alg, sig, &sig_len, msg, msg_len, sk) != 0) {
+            LOG_ERROR("Sign failed during verify_batch setup (pair %d)", i);
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+
+        msgs[i] = msg;
+        sigs[i] = sig;
+        sig_lens[i] = sig_len;
+    }
+
+    LOG_DEBUG("verify_batch corpus ready: %d pairs under one key", count);
+
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Resolve an operation name to its prepared context and callback
+ *
+ * Shared by the single-operation path and the interleaved engine, which
+ * prepares one context per algorithm before entering its common loop.
+ * The context is zeroed first, so fields an operation does not use stay
+ * NULL. sweep_msg_len selects a message-size sweep point for sign and
+ * verify and is ignored by the other operations.
+ */
+static int setup_operation_context(const PQCAlgorithm *alg,
+                                   const char *operation,
+                                   const BenchmarkConfig *config,
+                                   pqc_arena_t *arena,
+                                   size_t sweep_msg_len,
+                                   op_context_t *ctx,
+                                   benchmark_op_fn *op) {
+    memset(ctx, 0, sizeof(*ctx));
+
+    if (strcmp(operation, "keygen") == 0) {
+        *op = op_keygen;
+        return setup_keygen_context(alg, arena, ctx);
+    } else if (strcmp(operation, "encaps") == 0) {
+        *op = op_encaps;
+        return setup_encaps_context(alg, config, arena, ctx);
+    } else if (strcmp(operation, "decaps") == 0) {
+        *op = op_decaps;
+        return setup_decaps_context(alg, config, arena, ctx);
+    } else if (strcmp(operation, "handshake") == 0) {
+        *op = op_handshake;
+        return setup_handshake_context(alg, arena, ctx);
+    } else if (strcmp(operation, "sign") == 0) {
+        *op = op_sign;
+        return setup_sign_context(alg, config, arena, sweep_msg_len, ctx);
+    } else if (strcmp(operation, "verify") == 0) {
+        *op = op_verify;
+        return setup_verify_context(alg, config, arena, sweep_msg_len, ctx);
+    } else if (strcmp(operation, "verify_batch") == 0) {
+        *op = op_verify_batch;
+        return setup_verify_batch_context(alg, config, arena, ctx);
+    }
+
+    LOG_ERROR("Unknown operation: %s", operation);
+    return PQC_ERROR_INVALID_PARAM;
+}
+
+// ============================================================================
+// Baseline Regression Detection
+// ============================================================================
+
+/**
+ * @brief Load the baseline sample column for one (algorithm, operation)
+ *
+ * Reads the binary dump pqc_benchmark_write_samples() produced for the
+ * baseline campaign, using the same file naming. A missing file is
+ * reported at WARN level (new operations have no baseline yet); a file
+ * that exists but does not parse is an error.
+ */
+static int load_baseline_samples(const char *dir, const BenchmarkResult *result,
+                                 uint64_t **samples, size_t *num_samples) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s_%s_%s.samples",
+             dir, result->algorithm, result->operation, result->architecture);
+
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        LOG_WARN("No baseline for %s/%s (%s missing), skipping comparison",
+                 result->algorithm, result->operation, path);
+        return PQC_ERROR_IO;
+    }
+
+    pqc_sample_file_header_t header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, PQC_SAMPLE_FILE_MAGIC,
+               sizeof(header.magic)) != 0 ||
+        header.sample_width != (uint32_t)sizeof(uint64_t) ||
+        header.num_samples == 0) {
+        LOG_ERROR("Invalid baseline sample file: %s", path);
+        fclose(fp);
+        return PQC_ERROR_IO;
+    }
+
+    uint64_t *data = (uint64_t*)malloc((size_t)header.num_samples *
+                                       sizeof(uint64_t));
+    if (data == NULL) {
+        LOG_ERROR("Failed to allocate baseline sample array");
+        fclose(fp);
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    if (fseek(fp, (long)header.header_size, SEEK_SET) != 0 ||
+        fread(data, sizeof(uint64_t), (size_t)header.num_samples, fp) !=
+            (size_t)header.num_samples) {
+        LOG_ERROR("Failed to read baseline samples from %s", path);
+        free(data);
+        fclose(fp);
+        return PQC_ERROR_IO;
+    }
+
+    fclose(fp);
+
+    *samples = data;
+    *num_samples = (size_t)header.num_samples;
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Compare a fresh result against the baseline campaign
+ *
+ * Runs at the end of the operation while the sample array is still in
+ * memory: loads the matching baseline column, tests for a location shift
+ * with Mann-Whitney, and marks the result regressed when the median
+ * slowed by more than config->regression_threshold AND the shift is
+ * significant at 99% confidence (z > 2.576). The significance gate stops
+ * run-to-run noise from failing CI on fast operations; the threshold
+ * gate stops statistically-real-but-tiny shifts from doing the same on
+ * slow ones.
+ */
+static void check_baseline_regression(const BenchmarkConfig *config,
+                                      BenchmarkResult *result) {
+    uint64_t *baseline = NULL;
+    size_t baseline_n = 0;
+
+    if (load_baseline_samples(config->baseline_dir, result,
+                              &baseline, &baseline_n) != PQC_SUCCESS) {
+        return;  // No baseline is not a failure: new operations pass
+    }
+
+    double z = pqc_stats_mann_whitney_z(baseline, baseline_n,
+                                        result->samples,
+                                        (size_t)result->num_samples);
+
+    // pqc_stats_median sorts in place; the baseline copy is ours to sort
+    double baseline_median_us = pqc_stats_median(baseline, baseline_n) / 1000.0;
+    free(baseline);
+
+    if (baseline_median_us <= 0.0) {
+        LOG_ERROR("Degenerate baseline median for %s/%s, skipping comparison",
+                  result->algorithm, result->operation);
+        return;
+    }
+
+    double delta = (result->median - baseline_median_us) / baseline_median_us;
+
+    result->regression_checked = true;
+    result->baseline_median = baseline_median_us;
+    result->median_delta = delta;
+    result->regression_z = z;
+    result->regressed = (delta > config->regression_threshold && z > 2.576);
+
+    if (result->regressed) {
+        LOG_ERROR("REGRESSION %s/%s: median %.2f µs vs baseline %.2f µs "
+                  "(%+.1f%%, z=%.1f)",
+                  result->algorithm, result->operation,
+                  result->median, baseline_median_us, delta * 100.0, z);
+    } else {
+        LOG_INFO("%s/%s vs baseline: median %.2f µs vs %.2f µs "
+                 "(%+.1f%%, z=%.1f)",
+                 result->algorithm, result->operation,
+                 result->median, baseline_median_us, delta * 100.0, z);
+    }
+}
+
+// ============================================================================
+// Main Benchmark Functions
+// ============================================================================
+
+/**
+ * @brief Determine the operations applicable to an algorithm
+ * @param alg Algorithm to inspect
+ * @param operations Output array (must hold at least 5 entries)
+ * @param num_operations Output: number of operations written
+ * @return 0 on success, negative error code for unknown algorithm types
+ */
+static int get_algorithm_operations(const PQCAlgorithm *alg,
+                                    const char **operations,
+                                    int *num_operations) {
+    int count = 0;
+
+    if (pqc_algorithm_is_kem(alg)) {
+        operations[count++] = "keygen";
+        operations[count++] = "encaps";
+        operations[count++] = "decaps";
+        operations[count++] = "handshake";
+    } else if (pqc_algorithm_is_signature(alg)) {
+        operations[count++] = "keygen";
+        operations[count++] = "sign";
+        operations[count++] = "verify";
+        operations[count++] = "verify_batch";
+    } else {
+        LOG_ERROR("Unknown algorithm type");
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    *num_operations = count;
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Benchmark one operation with buffers carved from a shared arena
+ *
+ * Core of pqc_benchmark_operation(); factored out so campaign-level
+ * callers (pqc_benchmark_algorithm, the parallel workers) can reuse one
+ * arena reservation across operations. The arena is reset on entry, so
+ * each operation starts from a clean region. sweep_msg_len selects a
+ * message-size sweep point for sign/verify (0 = default message) and is
+ * ignored by the other operations.
+ */
+static int benchmark_operation_in_arena(const PQCAlgorithm *alg,
+                                        const char *operation,
+                                        const BenchmarkConfig *config,
+                                        pqc_arena_t *arena,
+                                        size_t sweep_msg_len,
+                                        BenchmarkResult **result) {
+    if (alg == NULL || operation == NULL || config == NULL || result == NULL) {
+        LOG_ERROR("NULL parameter in benchmark_operation");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    pqc_arena_reset(arena);
+
+    // Validate algorithm
+    int ret = pqc_algorithm_validate(alg);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Algorithm validation failed");
+        return ret;
+    }
+    
+    // Validate config
+    ret = pqc_benchmark_config_validate(config);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Config validation failed");
+        return ret;
+    }
+    
+    // Apply the configured timing backend (falls back to monotonic if the
+    // cycle counter is unavailable on this platform)
+    if (pqc_timing_set_backend(config->timing_backend) != 0) {
+        LOG_WARN("Timing backend %s unavailable, using %s",
+                 pqc_timing_backend_string(config->timing_backend),
+                 pqc_timing_backend_string(pqc_timing_get_backend()));
+    }
+
+    // Get architecture
+    const char *arch = pqc_benchmark_get_architecture();
+
+    // Allocate result (streaming and adaptive modes retain no per-sample
+    // storage; adaptive does not know its sample count up front)
+    bool streaming = config->streaming_stats || config->adaptive_sampling;
+    int num_samples = streaming ? 0 : config->num_iterations;
+    *result = pqc_benchmark_result_alloc(alg->name, operation, arch,
+                                        num_samples);
+    if (*result == NULL) {
+        LOG_ERROR("Failed to allocate result");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+    (*result)->provider = alg->provider;
+
+    // Prepare the operation's buffers, then run the common loop
+    op_context_t ctx;
+    benchmark_op_fn op_fn = NULL;
+    ret = setup_operation_context(alg, operation, config, arena,
+                                  sweep_msg_len, &ctx, &op_fn);
+    if (ret == PQC_SUCCESS) {
+        // Sign/verify report the message size the samples cover
+        if (strcmp(operation, "sign") == 0 ||
+            strcmp(operation, "verify") == 0 ||
+            strcmp(operation, "verify_batch") == 0) {
+            (*result)->message_len = ctx.msg_len;
+        }
+
+        if (strcmp(operation, "verify_batch") == 0) {
+            // Batch verification is a throughput measurement by
+            // definition: each timed sample covers one full pass over
+            // the pair corpus, so the reported per-op numbers are
+            // amortized per signature
+            BenchmarkConfig batch_config = *config;
+            batch_config.measure_mode = PQC_MEASURE_MODE_THROUGHPUT;
+            batch_config.batch_size = ctx.batch_count;
+            ret = run_measurement_loop(operation, &batch_config, *result,
+                                       op_fn, &ctx);
+        } else {
+            ret = run_measurement_loop(operation, config, *result, op_fn,
+                                       &ctx);
+        }
+    }
+
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Benchmark operation failed");
+        pqc_benchmark_result_free(*result);
+        *result = NULL;
+        return ret;
+    }
+    
+    // Streaming mode computes its summary inline; outlier removal and
+    // post-hoc statistics both need the retained sample array
+    if (streaming) {
+        if (config->remove_outliers) {
+            LOG_WARN("Outlier removal is not available in streaming mode");
+        }
+        if (config->baseline_dir != NULL) {
+            LOG_WARN("Regression detection needs retained samples, "
+                     "not available in streaming mode");
+        }
+    } else {
+        // Remove outliers if requested
+        if (config->remove_outliers) {
+            size_t original_count = (*result)->num_samples;
+            size_t new_count = pqc_stats_remove_outliers((*result)->samples,
+                                                         original_count,
+                                                         config->outlier_threshold);
+            (*result)->num_samples = new_count;
+            LOG_INFO("Removed %zu outliers from %s",
+                     original_count - new_count, operation);
+        }
+
+        // Compute statistics
+        ret = pqc_benchmark_result_compute_stats(*result);
+        if (ret != PQC_SUCCESS) {
+            LOG_ERROR("Failed to compute statistics");
+            pqc_benchmark_result_free(*result);
+            *result = NULL;
+            return ret;
+        }
+
+        // Gate against the baseline while the samples are still in memory
+        if (config->baseline_dir != NULL) {
+            check_baseline_regression(config, *result);
+        }
+    }
+    
+    // Stream the record out while the rest of the campaign is still
+    // running; stream errors must not fail an otherwise good measurement
+    if (config->result_stream != NULL) {
+        if (pqc_result_stream_append(config->result_stream, *result) !=
+            PQC_SUCCESS) {
+            LOG_WARN("Failed to stream %s/%s record", alg->name, operation);
+        }
+    }
+
+    if (config->verbose) {
+        LOG_INFO("%s %s: mean=%.2f µs, median=%.2f µs, stddev=%.2f µs",
+                 alg->name, operation, (*result)->mean, (*result)->median,
+                 (*result)->std_dev);
+    }
+
+    return PQC_SUCCESS;
+}
+
+int pqc_benchmark_operation(const PQCAlgorithm *alg,
+                           const char *operation,
+                           const BenchmarkConfig *config,
+                           BenchmarkResult **result) {
+    if (alg == NULL || operation == NULL || config == NULL || result == NULL) {
+        LOG_ERROR("NULL parameter in benchmark_operation");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    // Standalone call: the arena lives for just this one operation
+    pqc_arena_t arena;
+    int ret = pqc_arena_init(&arena, arena_size_for_algorithm(alg, config));
+    if (ret != PQC_SUCCESS) {
+        return ret;
+    }
+
+    ret = benchmark_operation_in_arena(alg, operation, config, &arena, 0, result);
+
+    pqc_arena_destroy(&arena);
+
+    return ret;
+}
+
+int pqc_benchmark_algorithm(const PQCAlgorithm *alg,
+                           const BenchmarkConfig *config,
+                           BenchmarkResultSet **results) {
+    if (alg == NULL || config == NULL || results == NULL) {
+        LOG_ERROR("NULL parameter in benchmark_algorithm");
+        return PQC_ERROR_NULL_POINTER;
+    }
+    
+    // Validate algorithm
+    int ret = pqc_algorithm_validate(alg);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Algorithm validation failed");
+        return ret;
+    }
+    
+    // Validate config
+    ret = pqc_benchmark_config_validate(config);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Config validation failed");
+        return ret;
+    }
+    
+    // Determine operations to benchmark based on algorithm type
+    const char *operations[5];
+    int num_operations = 0;
+
+    ret = get_algorithm_operations(alg, operations, &num_operations);
+    if (ret != PQC_SUCCESS) {
+        return ret;
+    }
+
+    // Get architecture
+    const char *arch = pqc_benchmark_get_architecture();
+
+    // A configured message-size sweep expands sign and verify into one
+    // result per size point; KEM operations are unaffected
+    int sweep_sizes = 0;
+    if (config->num_message_sizes > 0 && pqc_algorithm_is_signature(alg)) {
+        sweep_sizes = config->num_message_sizes;
+    }
+
+    int num_results = num_operations;
+    if (sweep_sizes > 0) {
+        num_results = num_operations + 2 * (sweep_sizes - 1);
+    }
+
+    // Allocate result set
+    *results = pqc_benchmark_result_set_alloc(alg->name, arch, num_results);
+    if (*results == NULL) {
+        LOG_ERROR("Failed to allocate result set");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    // One arena reservation shared by every operation of this algorithm
+    pqc_arena_t arena;
+    ret = pqc_arena_init(&arena, arena_size_for_algorithm(alg, config));
+    if (ret != PQC_SUCCESS) {
+        pqc_benchmark_result_set_free(*results);
+        *results = NULL;
+        return ret;
+    }
+
+    // Benchmark each operation
+    LOG_INFO("Benchmarking %s (%s)", alg->name, pqc_algorithm_type_string(alg->type));
+
+    int slot = 0;
+    for (int i = 0; i < num_operations; i++) {
+        bool swept = sweep_sizes > 0 &&
+                     (strcmp(operations[i], "sign") == 0 ||
+                      strcmp(operations[i], "verify") == 0);
+        int points = swept ? sweep_sizes : 1;
+
+        for (int s = 0; s < points; s++) {
+            size_t sweep_msg_len = swept ? config->message_sizes[s] : 0;
+
+            BenchmarkResult *result = NULL;
+            ret = benchmark_operation_in_arena(alg, operations[i], config,
+                                               &arena, sweep_msg_len, &result);
+
+            if (ret != PQC_SUCCESS) {
+                LOG_ERROR("Failed to benchmark %s", operations[i]);
+                pqc_arena_destroy(&arena);
+                pqc_benchmark_result_set_free(*results);
+                *results = NULL;
+                return ret;
+            }
+
+            // Copy result into result set
+            (*results)->results[slot++] = *result;
+            free(result); // Free the container, but not the contents
+        }
+    }
+
+    pqc_arena_destroy(&arena);
+
+    return PQC_SUCCESS;
+}
+
+// ============================================================================
+// Interleaved A/B Measurement
+// ============================================================================
+
+// Upper bound on algorithms sharing one interleaved loop; sized for the
+// full ML-KEM + ML-DSA variant roster with headroom
+#define PQC_INTERLEAVE_MAX_ALGS 8
+
+/**
+ * @brief One full interleaved round as a single warmup operation
+ *
+ * Lets run_warmup() treat a round-robin pass over all participants as one
+ * iteration, so adaptive warmup converges on the interleaved steady state
+ * rather than on any single algorithm's.
+ */
+typedef struct {
+    benchmark_op_fn op;            ///< Shared operation callback
+    op_context_t *ctxs;            ///< Per-algorithm contexts
+    int num_algorithms;            ///< Number of participants
+} interleave_round_ctx_t;
+
+static int interleave_round_op(void *p) {
+    interleave_round_ctx_t *round = (interleave_round_ctx_t *)p;
+    int ret = 0;
+    for (int k = 0; k < round->num_algorithms; k++) {
+        int rc = round->op(&round->ctxs[k]);
+        if (rc != 0 && ret == 0) {
+            ret = rc;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Fill a result's summary statistics without reordering its samples
+ *
+ * pqc_stats_calculate() sorts in place, which would destroy the
+ * round-alignment that makes interleaved samples pairable, so the
+ * interleaved path summarizes from a scratch copy.
+ */
+static int compute_stats_preserving_order(BenchmarkResult *result) {
+    size_t n = (size_t)result->num_samples;
+
+    uint64_t *scratch = (uint64_t*)malloc(n * sizeof(uint64_t));
+    if (scratch == NULL) {
+        LOG_ERROR("Failed to allocate stats scratch buffer");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+    memcpy(scratch, result->samples, n * sizeof(uint64_t));
+
+    pqc_stats_t stats = pqc_stats_calculate(scratch, n);
+    free(scratch);
+
+    result->mean = pqc_ns_to_us(stats.mean);
+    result->median = pqc_ns_to_us(stats.median);
+    result->std_dev = pqc_ns_to_us(stats.stddev);
+    result->min = pqc_ns_to_us(stats.min);
+    result->max = pqc_ns_to_us(stats.max);
+    result->p95 = pqc_ns_to_us(stats.p95);
+    result->p99 = pqc_ns_to_us(stats.p99);
+
+    return PQC_SUCCESS;
+}
+
+int pqc_benchmark_interleaved(const PQCAlgorithm **algs, int num_algorithms,
+                             const char *operation,
+                             const BenchmarkConfig *config,
+                             BenchmarkResultSet **results) {
+    if (algs == NULL || operation == NULL || config == NULL ||
+        results == NULL) {
+        LOG_ERROR("NULL parameter in benchmark_interleaved");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    if (num_algorithms < 2 || num_algorithms > PQC_INTERLEAVE_MAX_ALGS) {
+        LOG_ERROR("Interleaved mode takes 2-%d algorithms, got %d",
+                  PQC_INTERLEAVE_MAX_ALGS, num_algorithms);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    // Pairing needs retained, round-aligned sample arrays; streaming and
+    // adaptive modes keep neither
+    if (config->streaming_stats || config->adaptive_sampling) {
+        LOG_ERROR("Interleaved mode is not available with streaming or "
+                  "adaptive sampling");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    int ret = pqc_benchmark_config_validate(config);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Config validation failed");
+        return ret;
+    }
+
+    for (int k = 0; k < num_algorithms; k++) {
+        ret = pqc_algorithm_validate(algs[k]);
+        if (ret != PQC_SUCCESS) {
+            LOG_ERROR("Algorithm validation failed");
+            return ret;
+        }
+    }
+
+    if (config->checkpoint_dir != NULL) {
+        LOG_WARN("Checkpointing is per-operation and not supported in "
+                 "interleaved mode");
+    }
+    if (config->perf_counters) {
+        LOG_WARN("Hardware counters cannot be attributed per algorithm in "
+                 "one interleaved loop, disabled");
+    }
+
+    const char *arch = pqc_benchmark_get_architecture();
+
+    // One arena covers every participant's buffers for the whole loop
+    size_t arena_size = 0;
+    for (int k = 0; k < num_algorithms; k++) {
+        arena_size += arena_size_for_algorithm(algs[k], config);
+    }
+
+    pqc_arena_t arena;
+    ret = pqc_arena_init(&arena, arena_size);
+    if (ret != PQC_SUCCESS) {
+        return ret;
+    }
+
+    // Prepare one context per algorithm; the callback is the same for all
+    // participants since they share the operation
+    op_context_t ctxs[PQC_INTERLEAVE_MAX_ALGS];
+    benchmark_op_fn op_fn = NULL;
+    BenchmarkResult *res[PQC_INTERLEAVE_MAX_ALGS] = { NULL };
+
+    for (int k = 0; k < num_algorithms && ret == PQC_SUCCESS; k++) {
+        ret = setup_operation_context(algs[k], operation, config, &arena,
+                                      0, &ctxs[k], &op_fn);
+        if (ret != PQC_SUCCESS) {
+            LOG_ERROR("Setup failed for %s/%s", algs[k]->name, operation);
+            break;
+        }
+
+        res[k] = pqc_benchmark_result_alloc(algs[k]->name, operation, arch,
+                                            config->num_iterations);
+        if (res[k] == NULL) {
+            ret = PQC_ERROR_MEMORY_ALLOC;
+            break;
+        }
+
+        res[k]->provider = algs[k]->provider;
+        res[k]->cold_cache = config->cold_cache;
+        if (strcmp(operation, "sign") == 0 ||
+            strcmp(operation, "verify") == 0) {
+            res[k]->message_len = ctxs[k].msg_len;
+        }
+        pqc_histogram_init(&res[k]->histogram);
+    }
+
+    uint8_t *evict_buf = NULL;
+
+#if !PQC_HAVE_CACHE_FLUSH
+    if (ret == PQC_SUCCESS && config->cold_cache) {
+        evict_buf = (uint8_t*)calloc(1, PQC_COLD_EVICT_BUFFER_SIZE);
+        if (evict_buf == NULL) {
+            LOG_ERROR("Failed to allocate cold-cache eviction buffer");
+            ret = PQC_ERROR_MEMORY_ALLOC;
+        }
+    }
+#endif
+
+    if (ret != PQC_SUCCESS) {
+        for (int k = 0; k < num_algorithms; k++) {
+            pqc_benchmark_result_free(res[k]);
+        }
+        free(evict_buf);
+        pqc_arena_destroy(&arena);
+        return ret;
+    }
+
+    if (pqc_timing_set_backend(config->timing_backend) != 0) {
+        LOG_WARN("Timing backend %s unavailable, using %s",
+                 pqc_timing_backend_string(config->timing_backend),
+                 pqc_timing_backend_string(pqc_timing_get_backend()));
+    }
+
+    if (config->pin_cpu >= 0) {
+        pin_thread_to_cpu(config->pin_cpu);
+    }
+
+    // Round-robin warmup so every participant's code paths settle before
+    // the first measured round; one warmup iteration is a full round, so
+    // adaptive warmup converges on the interleaved steady state
+    interleave_round_ctx_t round_ctx = { op_fn, ctxs, num_algorithms };
+    bool warmup_converged = false;
+    int warmup_used = run_warmup("interleaved", config, interleave_round_op,
+                                 &round_ctx, &warmup_converged);
+    for (int k = 0; k < num_algorithms; k++) {
+        res[k]->warmup_iterations_used = warmup_used;
+        res[k]->warmup_converged = warmup_converged;
+    }
+
+    int batch = 1;
+    if (config->measure_mode == PQC_MEASURE_MODE_THROUGHPUT) {
+        batch = config->batch_size;
+    }
+
+    // One telemetry window spans all participants; ambient conditions are
+    // shared by construction, which is the point of interleaving
+    pqc_cpu_telemetry_t telemetry;
+    bool telemetry_on = false;
+    if (config->cpu_telemetry) {
+        int monitored_cpu = (config->pin_cpu >= 0) ? config->pin_cpu : 0;
+        telemetry_on = (pqc_cpu_telemetry_start(&telemetry, monitored_cpu,
+                                                0) == PQC_SUCCESS);
+    }
+
+    LOG_INFO("Interleaving %d algorithms on %s: %d rounds (batch=%d)",
+             num_algorithms, operation, config->num_iterations, batch);
+
+    uint64_t total_ns[PQC_INTERLEAVE_MAX_ALGS] = { 0 };
+
+    // Each round takes one sample per algorithm back-to-back, so slow
+    // ambient drift (thermals, frequency, co-tenants) lands on every
+    // participant's distribution equally. Sample i of every result comes
+    // from round i: the arrays are pairable by index.
+    for (int i = 0; i < config->num_iterations && ret == PQC_SUCCESS; i++) {
+        for (int k = 0; k < num_algorithms; k++) {
+            if (config->cold_cache) {
+                evict_working_set(&ctxs[k], evict_buf);
+            }
+
+            pqc_timestamp_t start = pqc_timestamp_now();
+            for (int b = 0; b < batch; b++) {
+                if (op_fn(&ctxs[k]) != 0) {
+                    LOG_ERROR("%s/%s failed at round %d",
+                              algs[k]->name, operation, i);
+                    ret = PQC_ERROR_OPERATION_FAILED;
+                    break;
+                }
+            }
+            pqc_timestamp_t end = pqc_timestamp_now();
+
+            if (ret != PQC_SUCCESS) {
+                break;
+            }
+
+            uint64_t elapsed = pqc_timestamp_diff(start, end);
+            uint64_t per_op_ns = elapsed / (uint64_t)batch;
+
+            total_ns[k] += elapsed;
+            pqc_histogram_record(&res[k]->histogram, per_op_ns);
+            res[k]->samples[i] = per_op_ns;
+        }
+    }
+
+    if (telemetry_on) {
+        pqc_cpu_telemetry_stop(&telemetry);
+    }
+
+    if (ret != PQC_SUCCESS) {
+        for (int k = 0; k < num_algorithms; k++) {
+            pqc_benchmark_result_free(res[k]);
+        }
+        free(evict_buf);
+        pqc_arena_destroy(&arena);
+        return ret;
+    }
+
+    free(evict_buf);
+    pqc_arena_destroy(&arena);
+
+    // Summarize each participant; the shared telemetry window tags all of
+    // them identically
+    for (int k = 0; k < num_algorithms && ret == PQC_SUCCESS; k++) {
+        BenchmarkResult *r = res[k];
+        uint64_t total_ops =
+            (uint64_t)config->num_iterations * (uint64_t)batch;
+
+        r->batch_size = batch;
+        if (total_ns[k] > 0 && total_ops > 0) {
+            r->amortized_ns_op = (double)total_ns[k] / (double)total_ops;
+            r->throughput_ops_sec =
+                (double)total_ops / pqc_ns_to_s(total_ns[k]);
+        }
+
+        r->p999 = pqc_ns_to_us(
+            (pqc_time_ns_t)pqc_histogram_percentile(&r->histogram, 99.9));
+        r->p9999 = pqc_ns_to_us(
+            (pqc_time_ns_t)pqc_histogram_percentile(&r->histogram, 99.99));
+
+        ret = compute_stats_preserving_order(r);
+
+        if (ret == PQC_SUCCESS && telemetry_on && telemetry.num_samples > 0) {
+            r->telemetry_valid = true;
+            r->freq_min_mhz = (double)telemetry.freq_min_khz / 1000.0;
+            r->freq_max_mhz = (double)telemetry.freq_max_khz / 1000.0;
+            if (telemetry.freq_sum_khz > 0.0) {
+                r->freq_mean_mhz = telemetry.freq_sum_khz /
+                    (double)telemetry.num_samples / 1000.0;
+            }
+            r->temp_max_c = (double)telemetry.temp_max_mc / 1000.0;
+            r->freq_throttled =
+                (pqc_cpu_telemetry_freq_span(&telemetry) >
+                 config->freq_tolerance);
+        }
+
+        if (ret == PQC_SUCCESS && config->baseline_dir != NULL) {
+            check_baseline_regression(config, r);
+        }
+
+        if (ret == PQC_SUCCESS && config->result_stream != NULL) {
+            if (pqc_result_stream_append(config->result_stream, r) !=
+                PQC_SUCCESS) {
+                LOG_WARN("Failed to stream %s/%s record",
+                         algs[k]->name, operation);
+            }
+        }
+    }
+
+    if (ret != PQC_SUCCESS) {
+        for (int k = 0; k < num_algorithms; k++) {
+            pqc_benchmark_result_free(res[k]);
+        }
+        return ret;
+    }
+
+    // One result set holds all participants; per-result algorithm tags
+    // qualify each row in the writers
+    *results = pqc_benchmark_result_set_alloc("interleaved", arch,
+                                              num_algorithms);
+    if (*results == NULL) {
+        for (int k = 0; k < num_algorithms; k++) {
+            pqc_benchmark_result_free(res[k]);
+        }
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    for (int k = 0; k < num_algorithms; k++) {
+        (*results)->results[k] = *res[k];
+        free(res[k]); // Free the container, but not the contents
+    }
+
+    return PQC_SUCCESS;
+}
+
+// ============================================================================
+// Parallel Scheduling
+// ============================================================================
+
+/**
+ * @brief A single (algorithm, operation) work unit for the parallel scheduler
+ */
+typedef struct {
+    const PQCAlgorithm *alg;     ///< Algorithm to benchmark
+    const char *operation;       ///< Operation name
+    size_t sweep_msg_len;        ///< Message-sweep point for sign/verify (0 = default)
+    int alg_index;               ///< Index into the algorithm array
+    int op_index;                ///< Result slot within the algorithm's result set
+    BenchmarkResult *result;     ///< Result produced by the worker (owned by task)
+    int status;                  ///< Completion status (PQC_SUCCESS or error)
+} benchmark_task_t;
+
+/**
+ * @brief Shared task queue consumed by worker threads
+ *
+ * Workers only contend on next_task; every task writes into its own
+ * BenchmarkResult, so there is no shared mutable state during measurement.
+ */
+typedef struct {
+    benchmark_task_t *tasks;         ///< Array of tasks
+    int num_tasks;                   ///< Total number of tasks
+    int next_task;                   ///< Index of next unclaimed task
+    pthread_mutex_t lock;            ///< Protects next_task
+    const BenchmarkConfig *config;   ///< Shared benchmark configuration
+    size_t arena_capacity;           ///< Per-worker arena size (max over algorithms)
+} benchmark_task_queue_t;
+
+/**
+ * @brief Per-worker context passed to worker threads
+ */
+typedef struct {
+    benchmark_task_queue_t *queue;   ///< Shared task queue
+    int worker_index;                ///< Worker index (used for CPU affinity)
+} benchmark_worker_ctx_t;
+
+/**
+ * @brief Pin the calling thread to a specific CPU core
+ */
+static void pin_thread_to_cpu(int cpu) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+        LOG_WARN("Failed to pin worker to CPU %d", cpu);
+    } else {
+        LOG_DEBUG("Worker pinned to CPU %d", cpu);
+    }
+}
+
+/**
+ * @brief Worker thread: claims tasks from the queue until it is drained
+ */
+static void* benchmark_worker(void *arg) {
+    benchmark_worker_ctx_t *ctx = (benchmark_worker_ctx_t*)arg;
+    benchmark_task_queue_t *queue = ctx->queue;
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus > 0) {
+        pin_thread_to_cpu(ctx->worker_index % (int)num_cpus);
+    }
+
+    // Each worker owns one arena sized for the largest algorithm in the
+    // campaign; tasks reuse it instead of hitting the system allocator
+    pqc_arena_t arena;
+    int arena_status = pqc_arena_init(&arena, queue->arena_capacity);
+    if (arena_status != PQC_SUCCESS) {
+        LOG_ERROR("Worker %d: failed to reserve arena", ctx->worker_index);
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&queue->lock);
+        int task_index = queue->next_task;
+        if (task_index < queue->num_tasks) {
+            queue->next_task++;
+        }
+        pthread_mutex_unlock(&queue->lock);
+
+        if (task_index >= queue->num_tasks) {
+            break;
+        }
+
+        benchmark_task_t *task = &queue->tasks[task_index];
+
+        if (arena_status != PQC_SUCCESS) {
+            task->status = arena_status;
+            continue;
+        }
+
+        task->status = benchmark_operation_in_arena(task->alg, task->operation,
+                                                    queue->config, &arena,
+                                                    task->sweep_msg_len,
+                                                    &task->result);
+
+        if (task->status != PQC_SUCCESS) {
+            LOG_ERROR("Worker %d: benchmark of %s %s failed (%s)",
+                      ctx->worker_index, task->alg->name, task->operation,
+                      pqc_error_string(task->status));
+        }
+    }
+
+    pqc_arena_destroy(&arena);
+
+    return NULL;
+}
+
+int pqc_benchmark_algorithms_parallel(const PQCAlgorithm **algs,
+                                     int num_algorithms,
+                                     const BenchmarkConfig *config,
+                                     BenchmarkResultSet ***result_sets) {
+    if (algs == NULL || config == NULL || result_sets == NULL) {
+        LOG_ERROR("NULL parameter in benchmark_algorithms_parallel");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    if (num_algorithms <= 0) {
+        LOG_ERROR("Invalid num_algorithms: %d", num_algorithms);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    int ret = pqc_benchmark_config_validate(config);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("Config validation failed");
+        return ret;
+    }
+
+    // Build the task list: one task per (algorithm, operation) pair, with
+    // sign/verify expanded into one task per message-sweep point
+    const char *alg_operations[5];
+    int num_alg_operations = 0;
+    int num_tasks = 0;
+    size_t max_arena_size = 0;
+
+    int max_ops_per_alg = 5;
+    if (config->num_message_sizes > 0) {
+        max_ops_per_alg += 2 * (config->num_message_sizes - 1);
+    }
+
+    benchmark_task_t *tasks = (benchmark_task_t*)calloc(
+        (size_t)num_algorithms * (size_t)max_ops_per_alg,
+        sizeof(benchmark_task_t));
+    if (tasks == NULL) {
+        LOG_ERROR("Failed to allocate task list");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    for (int i = 0; i < num_algorithms; i++) {
+        ret = pqc_algorithm_validate(algs[i]);
+        if (ret != PQC_SUCCESS) {
+            LOG_ERROR("Algorithm validation failed for index %d", i);
+            free(tasks);
+            return ret;
+        }
+
+        ret = get_algorithm_operations(algs[i], alg_operations, &num_alg_operations);
+        if (ret != PQC_SUCCESS) {
+            free(tasks);
+            return ret;
+        }
+
+        size_t alg_arena_size = arena_size_for_algorithm(algs[i], config);
+        if (alg_arena_size > max_arena_size) {
+            max_arena_size = alg_arena_size;
+        }
+
+        int slot = 0;
+        for (int j = 0; j < num_alg_operations; j++) {
+            bool swept = config->num_message_sizes > 0 &&
+                         pqc_algorithm_is_signature(algs[i]) &&
+                         (strcmp(alg_operations[j], "sign") == 0 ||
+                          strcmp(alg_operations[j], "verify") == 0);
+            int points = swept ? config->num_message_sizes : 1;
+
+            for (int s = 0; s < points; s++) {
+                tasks[num_tasks].alg = algs[i];
+                tasks[num_tasks].operation = alg_operations[j];
+                tasks[num_tasks].sweep_msg_len =
+                    swept ? config->message_sizes[s] : 0;
+                tasks[num_tasks].alg_index = i;
+                tasks[num_tasks].op_index = slot++;
+                tasks[num_tasks].result = NULL;
+                tasks[num_tasks].status = PQC_SUCCESS;
+                num_tasks++;
+            }
+        }
+    }
+
+    // Size the worker pool: never more workers than tasks
+    int num_workers = config->parallel_workers;
+    if (num_workers <= 1) {
+        num_workers = 1;
+    }
+    if (num_workers > num_tasks) {
+        num_workers = num_tasks;
+    }
+
+    LOG_INFO("Parallel scheduler: %d tasks across %d workers", num_tasks, num_workers);
+
+    benchmark_task_queue_t queue = {
+        .tasks = tasks,
+        .num_tasks = num_tasks,
+        .next_task = 0,
+        .config = config,
+        .arena_capacity = max_arena_size
+    };
+    pthread_mutex_init(&queue.lock, NULL);
+
+    pthread_t *threads = (pthread_t*)calloc(num_workers, sizeof(pthread_t));
+    benchmark_worker_ctx_t *worker_ctx = (benchmark_worker_ctx_t*)calloc(
+        num_workers, sizeof(benchmark_worker_ctx_t));
+
+    if (threads == NULL || worker_ctx == NULL) {
+        LOG_ERROR("Failed to allocate worker pool");
+        free(threads);
+        free(worker_ctx);
+        free(tasks);
+        pthread_mutex_destroy(&queue.lock);
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    int started = 0;
+    for (int i = 0; i < num_workers; i++) {
+        worker_ctx[i].queue = &queue;
+        worker_ctx[i].worker_index = i;
+        if (pthread_create(&threads[i], NULL, benchmark_worker, &worker_ctx[i]) != 0) {
+            LOG_WARN("Failed to start worker %d", i);
+            break;
+        }
+        started++;
+    }
+
+    if (started == 0) {
+        // No workers could be started: drain the queue on the calling thread
+        LOG_WARN("No workers started, falling back to sequential execution");
+        benchmark_worker_ctx_t fallback_ctx = { .queue = &queue, .worker_index = 0 };
+        benchmark_worker(&fallback_ctx);
+    }
+
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    free(threads);
+    free(worker_ctx);
+    pthread_mutex_destroy(&queue.lock);
+
+    // Check for task failures before assembling result sets
+    ret = PQC_SUCCESS;
+    for (int i = 0; i < num_tasks; i++) {
+        if (tasks[i].status != PQC_SUCCESS) {
+            ret = tasks[i].status;
+            break;
+        }
+    }
+
+    if (ret != PQC_SUCCESS) {
+        for (int i = 0; i < num_tasks; i++) {
+            pqc_benchmark_result_free(tasks[i].result);
+        }
+        free(tasks);
+        return ret;
+    }
+
+    // Merge per-task results into per-algorithm result sets
+    const char *arch = pqc_benchmark_get_architecture();
+    BenchmarkResultSet **sets = (BenchmarkResultSet**)calloc(
+        num_algorithms, sizeof(BenchmarkResultSet*));
+    if (sets == NULL) {
+        LOG_ERROR("Failed to allocate result set array");
+        for (int i = 0; i < num_tasks; i++) {
+            pqc_benchmark_result_free(tasks[i].result);
+        }
+        free(tasks);
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    for (int i = 0; i < num_algorithms; i++) {
+        int ops_for_alg = 0;
+        for (int t = 0; t < num_tasks; t++) {
+            if (tasks[t].alg_index == i) {
+                ops_for_alg++;
+            }
+        }
+
+        sets[i] = pqc_benchmark_result_set_alloc(algs[i]->name, arch, ops_for_alg);
+        if (sets[i] == NULL) {
+            LOG_ERROR("Failed to allocate result set for %s", algs[i]->name);
+            ret = PQC_ERROR_MEMORY_ALLOC;
+            break;
+        }
+
+        for (int t = 0; t < num_tasks; t++) {
+            if (tasks[t].alg_index == i) {
+                // Copy result into result set (same ownership transfer as
+                // the sequential path in pqc_benchmark_algorithm)
+                sets[i]->results[tasks[t].op_index] = *tasks[t].result;
+                free(tasks[t].result);
+                tasks[t].result = NULL;
+            }
+        }
+    }
+
+    if (ret != PQC_SUCCESS) {
+        for (int i = 0; i < num_algorithms; i++) {
+            pqc_benchmark_result_set_free(sets[i]);
+        }
+        free(sets);
+        for (int i = 0; i < num_tasks; i++) {
+            pqc_benchmark_result_free(tasks[i].result);
+        }
+        free(tasks);
         return ret;
     }
-    
-    if (config->verbose) {
-        LOG_INFO("%s %s: mean=%.2f µs, median=%.2f µs, stddev=%.2f µs",
-                 alg->name, operation, (*result)->mean, (*result)->median, 
-                 (*result)->std_dev);
-    }
-    
+
+    free(tasks);
+    *result_sets = sets;
+
     return PQC_SUCCESS;
 }
 
-int pqc_benchmark_algorithm(const PQCAlgorithm *alg,
-                           const BenchmarkConfig *config,
-                           BenchmarkResultSet **results) {
-    if (alg == NULL || config == NULL || results == NULL) {
-        LOG_ERROR("NULL parameter in benchmark_algorithm");
+// ============================================================================
+// Multi-Process Contention
+// ============================================================================
+
+/**
+ * @brief Start barrier shared by the contention processes
+ *
+ * Lives at the head of the shared segment; children report in via ready
+ * and spin on go, so all measured windows open together.
+ */
+typedef struct {
+    _Atomic int ready;               ///< Children that reached the barrier
+    _Atomic int go;                  ///< Set by the parent to release them
+} contention_barrier_t;
+
+/**
+ * @brief Per-process slot header in the shared segment
+ *
+ * The slot's sample stream (config->num_iterations uint64_t values)
+ * follows immediately after the header.
+ */
+typedef struct {
+    int status;                      ///< Child completion status (PQC_* code)
+    int num_samples;                 ///< Samples actually written
+    double throughput_ops_sec;       ///< Child's sustained throughput
+} contention_slot_t;
+
+// Slot headers and sample streams are padded to cache-line multiples so
+// concurrent writers never share a line
+#define PQC_CONTENTION_ALIGN 64
+
+static size_t contention_align(size_t n) {
+    return (n + PQC_CONTENTION_ALIGN - 1) & ~((size_t)PQC_CONTENTION_ALIGN - 1);
+}
+
+/**
+ * @brief Body of one forked benchmark process
+ *
+ * Pins itself, waits on the shared barrier, runs the operation with the
+ * standard single-process path and publishes its sample stream and
+ * throughput into its slot. Never returns.
+ */
+static void contention_child(const PQCAlgorithm *alg, const char *operation,
+                             const BenchmarkConfig *config,
+                             contention_barrier_t *barrier,
+                             contention_slot_t *slot, uint64_t *samples,
+                             int proc_index) {
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus > 0) {
+        pin_thread_to_cpu(proc_index % (int)num_cpus);
+    }
+
+    atomic_fetch_add(&barrier->ready, 1);
+    while (!atomic_load(&barrier->go)) {
+        sched_yield();
+    }
+
+    BenchmarkResult *result = NULL;
+    int ret = pqc_benchmark_operation(alg, operation, config, &result);
+
+    if (ret == PQC_SUCCESS && result != NULL && result->samples != NULL) {
+        memcpy(samples, result->samples,
+               (size_t)result->num_samples * sizeof(uint64_t));
+        slot->num_samples = result->num_samples;
+        slot->throughput_ops_sec = result->throughput_ops_sec;
+    }
+    slot->status = ret;
+
+    pqc_benchmark_result_free(result);
+    _exit(ret == PQC_SUCCESS ? 0 : 1);
+}
+
+int pqc_benchmark_contention(const PQCAlgorithm *alg,
+                            const char *operation,
+                            const BenchmarkConfig *config,
+                            const int *process_counts,
+                            int num_process_counts,
+                            BenchmarkResultSet **results) {
+    if (alg == NULL || operation == NULL || config == NULL ||
+        process_counts == NULL || results == NULL) {
+        LOG_ERROR("NULL parameter in benchmark_contention");
         return PQC_ERROR_NULL_POINTER;
     }
-    
-    // Validate algorithm
-    int ret = pqc_algorithm_validate(alg);
-    if (ret != PQC_SUCCESS) {
-        LOG_ERROR("Algorithm validation failed");
-        return ret;
+
+    if (num_process_counts <= 0) {
+        LOG_ERROR("Invalid num_process_counts: %d", num_process_counts);
+        return PQC_ERROR_INVALID_PARAM;
     }
-    
-    // Validate config
-    ret = pqc_benchmark_config_validate(config);
+
+    // The parent pools raw per-process samples, so the children must
+    // retain them: streaming and adaptive modes are not supported here
+    if (config->streaming_stats || config->adaptive_sampling) {
+        LOG_ERROR("Contention mode requires retained samples "
+                  "(disable streaming/adaptive sampling)");
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    int ret = pqc_benchmark_config_validate(config);
     if (ret != PQC_SUCCESS) {
-        LOG_ERROR("Config validation failed");
         return ret;
     }
-    
-    // Determine operations to benchmark based on algorithm type
-    const char *operations[5];
-    int num_operations = 0;
-    
-    if (pqc_algorithm_is_kem(alg)) {
-        operations[num_operations++] = "keygen";
-        operations[num_operations++] = "encaps";
-        operations[num_operations++] = "decaps";
-    } else if (pqc_algorithm_is_signature(alg)) {
-        operations[num_operations++] = "keygen";
-        operations[num_operations++] = "sign";
-        operations[num_operations++] = "verify";
-    } else {
-        LOG_ERROR("Unknown algorithm type");
-        return PQC_ERROR_INVALID_PARAM;
+
+    for (int c = 0; c < num_process_counts; c++) {
+        if (process_counts[c] <= 0) {
+            LOG_ERROR("Invalid process count at index %d: %d",
+                      c, process_counts[c]);
+            return PQC_ERROR_INVALID_PARAM;
+        }
     }
-    
-    // Get architecture
+
     const char *arch = pqc_benchmark_get_architecture();
-    
-    // Allocate result set
-    *results = pqc_benchmark_result_set_alloc(alg->name, arch, num_operations);
+
+    *results = pqc_benchmark_result_set_alloc(alg->name, arch,
+                                              num_process_counts);
     if (*results == NULL) {
-        LOG_ERROR("Failed to allocate result set");
         return PQC_ERROR_MEMORY_ALLOC;
     }
-    
-    // Benchmark each operation
-    LOG_INFO("Benchmarking %s (%s)", alg->name, pqc_algorithm_type_string(alg->type));
-    
-    for (int i = 0; i < num_operations; i++) {
-        BenchmarkResult *result = NULL;
-        ret = pqc_benchmark_operation(alg, operations[i], config, &result);
-        
+
+    // Children run the plain single-process path; the contention comes
+    // from the concurrent processes, not from in-process workers
+    BenchmarkConfig child_config = *config;
+    child_config.parallel_workers = 0;
+
+    // Every child runs the same (algorithm, operation), so an inherited
+    // checkpoint_dir would have N processes writing one spill file, and an
+    // inherited result_stream is a pre-fork FILE* the children would append
+    // through with independent stdio buffers: drop both before forking
+    if (child_config.checkpoint_dir != NULL) {
+        LOG_WARN("Checkpointing is disabled during the contention sweep");
+        child_config.checkpoint_dir = NULL;
+    }
+    if (child_config.result_stream != NULL) {
+        LOG_WARN("Result streaming is disabled during the contention sweep");
+        child_config.result_stream = NULL;
+    }
+
+    size_t slot_bytes = contention_align(sizeof(contention_slot_t)) +
+        contention_align((size_t)config->num_iterations * sizeof(uint64_t));
+
+    for (int c = 0; c < num_process_counts; c++) {
+        int procs = process_counts[c];
+
+        size_t seg_bytes = contention_align(sizeof(contention_barrier_t)) +
+                           (size_t)procs * slot_bytes;
+
+        uint8_t *seg = (uint8_t*)mmap(NULL, seg_bytes,
+                                      PROT_READ | PROT_WRITE,
+                                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (seg == MAP_FAILED) {
+            LOG_ERROR("Failed to map %zu-byte shared segment", seg_bytes);
+            pqc_benchmark_result_set_free(*results);
+            *results = NULL;
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+        memset(seg, 0, seg_bytes);
+
+        contention_barrier_t *barrier = (contention_barrier_t*)seg;
+        uint8_t *slots = seg + contention_align(sizeof(contention_barrier_t));
+
+        LOG_INFO("Contention sweep: %s/%s with %d processes",
+                 alg->name, operation, procs);
+
+        // Mark slots as failed until a child overwrites its status, so
+        // crashed children are not mistaken for successful ones
+        for (int p = 0; p < procs; p++) {
+            contention_slot_t *slot = (contention_slot_t*)(slots + (size_t)p * slot_bytes);
+            slot->status = PQC_ERROR_OPERATION_FAILED;
+        }
+
+        pid_t *pids = (pid_t*)calloc((size_t)procs, sizeof(pid_t));
+        if (pids == NULL) {
+            munmap(seg, seg_bytes);
+            pqc_benchmark_result_set_free(*results);
+            *results = NULL;
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+
+        int started = 0;
+        for (int p = 0; p < procs; p++) {
+            pid_t pid = fork();
+            if (pid < 0) {
+                LOG_ERROR("fork failed for contention process %d", p);
+                break;
+            }
+            if (pid == 0) {
+                contention_slot_t *slot =
+                    (contention_slot_t*)(slots + (size_t)p * slot_bytes);
+                uint64_t *samples = (uint64_t*)(slots + (size_t)p * slot_bytes +
+                    contention_align(sizeof(contention_slot_t)));
+                contention_child(alg, operation, &child_config,
+                                 barrier, slot, samples, p);
+                // Not reached
+            }
+            pids[started++] = pid;
+        }
+
+        // Release the barrier once every started child has reported in;
+        // a partial start still runs so the parent can report the failure
+        while (atomic_load(&barrier->ready) < started) {
+            sched_yield();
+        }
+        atomic_store(&barrier->go, 1);
+
+        int failed = (started < procs) ? (procs - started) : 0;
+        for (int p = 0; p < started; p++) {
+            int wstatus = 0;
+            waitpid(pids[p], &wstatus, 0);
+            if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0) {
+                failed++;
+            }
+        }
+        free(pids);
+
+        if (failed > 0) {
+            LOG_ERROR("%d/%d contention processes failed at N=%d",
+                      failed, procs, procs);
+            munmap(seg, seg_bytes);
+            pqc_benchmark_result_set_free(*results);
+            *results = NULL;
+            return PQC_ERROR_OPERATION_FAILED;
+        }
+
+        // Pool the per-process sample streams: the pooled distribution is
+        // the per-process latency under contention, the summed throughput
+        // is the aggregate host rate
+        int total_samples = 0;
+        double aggregate_throughput = 0.0;
+        for (int p = 0; p < procs; p++) {
+            contention_slot_t *slot =
+                (contention_slot_t*)(slots + (size_t)p * slot_bytes);
+            total_samples += slot->num_samples;
+            aggregate_throughput += slot->throughput_ops_sec;
+        }
+
+        BenchmarkResult *result = pqc_benchmark_result_alloc(
+            alg->name, operation, arch, total_samples);
+        if (result == NULL) {
+            munmap(seg, seg_bytes);
+            pqc_benchmark_result_set_free(*results);
+            *results = NULL;
+            return PQC_ERROR_MEMORY_ALLOC;
+        }
+        result->provider = alg->provider;
+
+        pqc_histogram_init(&result->histogram);
+
+        int n = 0;
+        for (int p = 0; p < procs; p++) {
+            contention_slot_t *slot =
+                (contention_slot_t*)(slots + (size_t)p * slot_bytes);
+            const uint64_t *samples = (const uint64_t*)(slots +
+                (size_t)p * slot_bytes +
+                contention_align(sizeof(contention_slot_t)));
+            for (int s = 0; s < slot->num_samples; s++) {
+                result->samples[n++] = samples[s];
+                pqc_histogram_record(&result->histogram, samples[s]);
+            }
+        }
+        result->num_samples = n;
+
+        munmap(seg, seg_bytes);
+
+        ret = pqc_benchmark_result_compute_stats(result);
         if (ret != PQC_SUCCESS) {
-            LOG_ERROR("Failed to benchmark %s", operations[i]);
+            pqc_benchmark_result_free(result);
             pqc_benchmark_result_set_free(*results);
             *results = NULL;
             return ret;
         }
-        
-        // Copy result into result set
-        (*results)->results[i] = *result;
-        free(result); // Free the container, but not the contents
+
+        result->p999 = pqc_ns_to_us(
+            (pqc_time_ns_t)pqc_histogram_percentile(&result->histogram, 99.9));
+        result->p9999 = pqc_ns_to_us(
+            (pqc_time_ns_t)pqc_histogram_percentile(&result->histogram, 99.99));
+
+        result->contention_procs = procs;
+        result->cold_cache = config->cold_cache;
+        result->batch_size =
+            (config->measure_mode == PQC_MEASURE_MODE_THROUGHPUT)
+                ? config->batch_size : 1;
+        result->throughput_ops_sec = aggregate_throughput;
+        if (aggregate_throughput > 0.0) {
+            // Host-level amortized cost; per-process latency is the mean
+            result->amortized_ns_op = 1e9 / aggregate_throughput;
+        }
+
+        (*results)->results[c] = *result;
+        free(result);  // Free the container, but not the contents
     }
-    
+
     return PQC_SUCCESS;
 }
 
@@ -717,7 +3218,27 @@ int pqc_benchmark_write_json(const BenchmarkResultSet *result_set,
         const BenchmarkResult *r = &result_set->results[i];
         
         fprintf(fp, "    {\n");
+        // Consolidated sets (unified runner) mix algorithms; tag each entry
+        if (r->algorithm && strcmp(r->algorithm, result_set->algorithm) != 0) {
+            fprintf(fp, "      \"algorithm\": \"%s\",\n", r->algorithm);
+        }
+        if (r->provider != NULL) {
+            fprintf(fp, "      \"provider\": \"%s\",\n", r->provider);
+        }
         fprintf(fp, "      \"operation\": \"%s\",\n", r->operation);
+        if (r->message_len > 0) {
+            fprintf(fp, "      \"message_len\": %zu,\n", r->message_len);
+        }
+        fprintf(fp, "      \"cache_regime\": \"%s\",\n",
+                r->cold_cache ? "cold" : "hot");
+        if (r->contention_procs > 0) {
+            fprintf(fp, "      \"num_processes\": %d,\n", r->contention_procs);
+        }
+        fprintf(fp, "      \"warmup_iterations\": %d,\n",
+                r->warmup_iterations_used);
+        if (r->warmup_converged) {
+            fprintf(fp, "      \"warmup_converged\": true,\n");
+        }
         fprintf(fp, "      \"num_samples\": %d,\n", r->num_samples);
         fprintf(fp, "      \"mean_us\": %.2f,\n", r->mean);
         fprintf(fp, "      \"median_us\": %.2f,\n", r->median);
@@ -725,7 +3246,71 @@ int pqc_benchmark_write_json(const BenchmarkResultSet *result_set,
         fprintf(fp, "      \"min_us\": %.2f,\n", r->min);
         fprintf(fp, "      \"max_us\": %.2f,\n", r->max);
         fprintf(fp, "      \"p95_us\": %.2f,\n", r->p95);
-        fprintf(fp, "      \"p99_us\": %.2f\n", r->p99);
+        fprintf(fp, "      \"p99_us\": %.2f,\n", r->p99);
+        fprintf(fp, "      \"p999_us\": %.2f,\n", r->p999);
+        fprintf(fp, "      \"p9999_us\": %.2f,\n", r->p9999);
+        fprintf(fp, "      \"batch_size\": %d,\n", r->batch_size);
+        fprintf(fp, "      \"throughput_ops_sec\": %.2f,\n", r->throughput_ops_sec);
+        fprintf(fp, "      \"ns_per_op\": %.2f,\n", r->amortized_ns_op);
+
+        if (r->ci_half_width_rel > 0.0) {
+            fprintf(fp, "      \"ci_converged\": %s,\n",
+                    r->ci_converged ? "true" : "false");
+            fprintf(fp, "      \"ci_half_width_rel\": %.4f,\n",
+                    r->ci_half_width_rel);
+        }
+
+        if (r->perf_valid) {
+            fprintf(fp, "      \"perf\": {\n");
+            fprintf(fp, "        \"cycles_per_op\": %.1f,\n", r->cycles_per_op);
+            fprintf(fp, "        \"instructions_per_op\": %.1f,\n",
+                    r->instructions_per_op);
+            fprintf(fp, "        \"ipc\": %.3f,\n", r->ipc);
+            fprintf(fp, "        \"l1d_mpki\": %.3f,\n", r->l1d_mpki);
+            fprintf(fp, "        \"llc_mpki\": %.3f,\n", r->llc_mpki);
+            fprintf(fp, "        \"branch_mpki\": %.3f\n", r->branch_mpki);
+            fprintf(fp, "      },\n");
+        }
+
+        if (r->telemetry_valid) {
+            fprintf(fp, "      \"telemetry\": {\n");
+            fprintf(fp, "        \"freq_mean_mhz\": %.1f,\n", r->freq_mean_mhz);
+            fprintf(fp, "        \"freq_min_mhz\": %.1f,\n", r->freq_min_mhz);
+            fprintf(fp, "        \"freq_max_mhz\": %.1f,\n", r->freq_max_mhz);
+            fprintf(fp, "        \"temp_max_c\": %.1f,\n", r->temp_max_c);
+            fprintf(fp, "        \"throttled\": %s\n",
+                    r->freq_throttled ? "true" : "false");
+            fprintf(fp, "      },\n");
+        }
+
+        if (r->regression_checked) {
+            fprintf(fp, "      \"baseline\": {\n");
+            fprintf(fp, "        \"median_us\": %.2f,\n", r->baseline_median);
+            fprintf(fp, "        \"median_delta_pct\": %.2f,\n",
+                    r->median_delta * 100.0);
+            fprintf(fp, "        \"z_score\": %.2f,\n", r->regression_z);
+            fprintf(fp, "        \"regressed\": %s\n",
+                    r->regressed ? "true" : "false");
+            fprintf(fp, "      },\n");
+        }
+
+        // Histogram: only the occupied buckets, as [lower_ns, count] pairs
+        fprintf(fp, "      \"histogram_ns\": [");
+        int first_bucket = 1;
+        for (int b = 0; b < (int)PQC_HIST_NUM_BUCKETS; b++) {
+            if (r->histogram.counts[b] == 0) {
+                continue;
+            }
+            uint64_t lower;
+            pqc_histogram_bucket_bounds(b, &lower, NULL);
+            fprintf(fp, "%s[%llu, %llu]", first_bucket ? "" : ", ",
+                    (unsigned long long)lower,
+                    (unsigned long long)r->histogram.counts[b]);
+            first_bucket = 0;
+        }
+        fprintf(fp, "],\n");
+        fprintf(fp, "      \"histogram_overflow\": %llu\n",
+                (unsigned long long)r->histogram.overflow);
         fprintf(fp, "    }%s\n", (i < result_set->num_results - 1) ? "," : "");
     }
     
@@ -739,45 +3324,147 @@ int pqc_benchmark_write_json(const BenchmarkResultSet *result_set,
     return PQC_SUCCESS;
 }
 
+/**
+ * @brief Emit the CSV column header
+ */
+static void csv_write_header(FILE *fp) {
+    fprintf(fp, "algorithm,provider,architecture,operation,message_len,cache_regime,num_processes,num_samples,");
+    fprintf(fp, "mean_us,median_us,stddev_us,min_us,max_us,p95_us,p99_us,");
+    fprintf(fp, "p999_us,p9999_us,batch_size,throughput_ops_sec,ns_per_op,");
+    fprintf(fp, "cycles_per_op,instructions_per_op,ipc,l1d_mpki,llc_mpki,branch_mpki,");
+    fprintf(fp, "freq_mean_mhz,freq_min_mhz,freq_max_mhz,temp_max_c,throttled,");
+    fprintf(fp, "warmup_iterations\n");
+}
+
+/**
+ * @brief Emit one result as a CSV row
+ *
+ * algorithm and architecture are passed explicitly so set-level writers
+ * can fall back to the set's tags for untagged results.
+ */
+static void csv_write_row(FILE *fp, const BenchmarkResult *r,
+                          const char *algorithm, const char *architecture) {
+    fprintf(fp, "%s,%s,%s,%s,%zu,%s,%d,%d,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%.2f,%.2f,"
+                "%.1f,%.1f,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f,%.1f,%d,%d\n",
+            algorithm,
+            r->provider ? r->provider : "",
+            architecture,
+            r->operation,
+            r->message_len,
+            r->cold_cache ? "cold" : "hot",
+            r->contention_procs,
+            r->num_samples,
+            r->mean,
+            r->median,
+            r->std_dev,
+            r->min,
+            r->max,
+            r->p95,
+            r->p99,
+            r->p999,
+            r->p9999,
+            r->batch_size,
+            r->throughput_ops_sec,
+            r->amortized_ns_op,
+            r->cycles_per_op,
+            r->instructions_per_op,
+            r->ipc,
+            r->l1d_mpki,
+            r->llc_mpki,
+            r->branch_mpki,
+            r->freq_mean_mhz,
+            r->freq_min_mhz,
+            r->freq_max_mhz,
+            r->temp_max_c,
+            r->freq_throttled ? 1 : 0,
+            r->warmup_iterations_used);
+}
+
 int pqc_benchmark_write_csv(const BenchmarkResultSet *result_set,
                            const char *path) {
     if (result_set == NULL || path == NULL) {
         LOG_ERROR("NULL parameter in write_csv");
         return PQC_ERROR_NULL_POINTER;
     }
-    
+
     FILE *fp = fopen(path, "w");
     if (fp == NULL) {
         LOG_ERROR("Failed to open file: %s", path);
         return PQC_ERROR_IO;
     }
-    
-    // Write header
-    fprintf(fp, "algorithm,architecture,operation,num_samples,");
-    fprintf(fp, "mean_us,median_us,stddev_us,min_us,max_us,p95_us,p99_us\n");
-    
-    // Write data rows
+
+    csv_write_header(fp);
+
     for (int i = 0; i < result_set->num_results; i++) {
         const BenchmarkResult *r = &result_set->results[i];
-        
-        fprintf(fp, "%s,%s,%s,%d,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n",
-                result_set->algorithm,
-                result_set->architecture,
-                r->operation,
-                r->num_samples,
-                r->mean,
-                r->median,
-                r->std_dev,
-                r->min,
-                r->max,
-                r->p95,
-                r->p99);
+        csv_write_row(fp, r,
+                      r->algorithm ? r->algorithm : result_set->algorithm,
+                      result_set->architecture);
     }
-    
+
     fclose(fp);
-    
+
     LOG_INFO("Wrote CSV results to %s", path);
-    
+
+    return PQC_SUCCESS;
+}
+
+int pqc_benchmark_write_samples(const BenchmarkResultSet *result_set,
+                               const char *dir) {
+    if (result_set == NULL || dir == NULL) {
+        LOG_ERROR("NULL parameter in write_samples");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    for (int i = 0; i < result_set->num_results; i++) {
+        const BenchmarkResult *r = &result_set->results[i];
+
+        if (r->samples == NULL || r->num_samples <= 0) {
+            LOG_WARN("No stored samples for %s/%s (streaming mode?), skipping dump",
+                     result_set->algorithm, r->operation);
+            continue;
+        }
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s_%s_%s.samples",
+                 dir, r->algorithm ? r->algorithm : result_set->algorithm,
+                 r->operation, result_set->architecture);
+
+        FILE *fp = fopen(path, "wb");
+        if (fp == NULL) {
+            LOG_ERROR("Failed to open file: %s", path);
+            return PQC_ERROR_IO;
+        }
+
+        pqc_sample_file_header_t header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, PQC_SAMPLE_FILE_MAGIC, sizeof(header.magic));
+        header.header_size = (uint32_t)sizeof(header);
+        header.sample_width = (uint32_t)sizeof(uint64_t);
+        header.num_samples = (uint64_t)r->num_samples;
+        // Same fallback as the path: consolidated sets are named "all" or
+        // "interleaved", so the per-result name is the real algorithm
+        snprintf(header.algorithm, sizeof(header.algorithm), "%s",
+                 r->algorithm ? r->algorithm : result_set->algorithm);
+        snprintf(header.operation, sizeof(header.operation), "%s",
+                 r->operation);
+        snprintf(header.architecture, sizeof(header.architecture), "%s",
+                 result_set->architecture);
+
+        // Header plus one sequential write of the whole sample column
+        if (fwrite(&header, sizeof(header), 1, fp) != 1 ||
+            fwrite(r->samples, sizeof(uint64_t),
+                   (size_t)r->num_samples, fp) != (size_t)r->num_samples) {
+            LOG_ERROR("Failed to write samples to %s", path);
+            fclose(fp);
+            return PQC_ERROR_IO;
+        }
+
+        fclose(fp);
+
+        LOG_INFO("Wrote %d raw samples to %s", r->num_samples, path);
+    }
+
     return PQC_SUCCESS;
 }
 
@@ -795,7 +3482,24 @@ void pqc_benchmark_print_results(const BenchmarkResultSet *result_set) {
     for (int i = 0; i < result_set->num_results; i++) {
         const BenchmarkResult *r = &result_set->results[i];
         
-        printf("Operation: %s\n", r->operation);
+        // Consolidated sets mix algorithms; qualify the operation when needed
+        if (r->algorithm && strcmp(r->algorithm, result_set->algorithm) != 0) {
+            printf("Algorithm: %s\n", r->algorithm);
+        }
+        if (r->provider != NULL) {
+            printf("Provider:  %s\n", r->provider);
+        }
+        if (r->message_len > 0) {
+            printf("Operation: %s (msg=%zu B)\n", r->operation, r->message_len);
+        } else {
+            printf("Operation: %s\n", r->operation);
+        }
+        if (r->cold_cache) {
+            printf("  Cache:    cold (working set evicted per sample)\n");
+        }
+        if (r->contention_procs > 0) {
+            printf("  Procs:    %d concurrent processes\n", r->contention_procs);
+        }
         printf("  Samples:  %d\n", r->num_samples);
         printf("  Mean:     %.2f µs\n", r->mean);
         printf("  Median:   %.2f µs\n", r->median);
@@ -804,12 +3508,242 @@ void pqc_benchmark_print_results(const BenchmarkResultSet *result_set) {
         printf("  Max:      %.2f µs\n", r->max);
         printf("  P95:      %.2f µs\n", r->p95);
         printf("  P99:      %.2f µs\n", r->p99);
+        if (r->histogram.count > 0) {
+            // Compact tail table from the inline HDR histogram
+            printf("  Tail:     p99.9=%.2f µs, p99.99=%.2f µs, hmax=%.2f µs\n",
+                   r->p999, r->p9999,
+                   pqc_ns_to_us((pqc_time_ns_t)pqc_histogram_percentile(
+                       &r->histogram, 100.0)));
+        }
+        if (r->throughput_ops_sec > 0.0) {
+            printf("  Throughput: %.0f ops/sec (%.1f ns/op, batch=%d)\n",
+                   r->throughput_ops_sec, r->amortized_ns_op, r->batch_size);
+        }
+        if (r->ci_half_width_rel > 0.0) {
+            printf("  CI:       ±%.2f%% of mean (95%%)%s\n",
+                   r->ci_half_width_rel * 100.0,
+                   r->ci_converged ? "" : " [cap reached]");
+        }
+        if (r->warmup_converged) {
+            printf("  Warmup:   converged after %d iterations\n",
+                   r->warmup_iterations_used);
+        }
+        if (r->perf_valid) {
+            printf("  HW:       %.0f cycles/op, IPC=%.2f, "
+                   "L1d=%.2f MPKI, LLC=%.2f MPKI, branch=%.2f MPKI\n",
+                   r->cycles_per_op, r->ipc,
+                   r->l1d_mpki, r->llc_mpki, r->branch_mpki);
+        }
+        if (r->telemetry_valid) {
+            printf("  Clock:    %.0f MHz mean (%.0f-%.0f MHz), "
+                   "%.1f °C peak%s\n",
+                   r->freq_mean_mhz, r->freq_min_mhz, r->freq_max_mhz,
+                   r->temp_max_c,
+                   r->freq_throttled ? " [THROTTLED]" : "");
+        }
+        if (r->regression_checked) {
+            printf("  Baseline: median %+.1f%% vs %.2f µs (z=%+.1f)%s\n",
+                   r->median_delta * 100.0, r->baseline_median,
+                   r->regression_z,
+                   r->regressed ? " [REGRESSED]" : "");
+        }
         printf("\n");
     }
     
     printf("========================================\n\n");
 }
 
+// ============================================================================
+// Streaming Result Writer
+// ============================================================================
+
+/**
+ * @brief Emit one result as a compact single-line JSON record
+ *
+ * Mirrors the consolidated JSON fields except the histogram; optional
+ * blocks appear only when their data was collected, matching the
+ * consolidated writer's conventions.
+ */
+static void jsonl_write_record(FILE *fp, const BenchmarkResult *r,
+                               bool include_samples) {
+    fprintf(fp, "{\"algorithm\":\"%s\"", r->algorithm);
+    if (r->provider != NULL) {
+        fprintf(fp, ",\"provider\":\"%s\"", r->provider);
+    }
+    fprintf(fp, ",\"architecture\":\"%s\"", r->architecture);
+    fprintf(fp, ",\"operation\":\"%s\"", r->operation);
+    if (r->message_len > 0) {
+        fprintf(fp, ",\"message_len\":%zu", r->message_len);
+    }
+    fprintf(fp, ",\"cache_regime\":\"%s\"", r->cold_cache ? "cold" : "hot");
+    if (r->contention_procs > 0) {
+        fprintf(fp, ",\"num_processes\":%d", r->contention_procs);
+    }
+    fprintf(fp, ",\"warmup_iterations\":%d", r->warmup_iterations_used);
+    if (r->warmup_converged) {
+        fprintf(fp, ",\"warmup_converged\":true");
+    }
+    fprintf(fp, ",\"num_samples\":%d", r->num_samples);
+    fprintf(fp, ",\"mean_us\":%.2f", r->mean);
+    fprintf(fp, ",\"median_us\":%.2f", r->median);
+    fprintf(fp, ",\"stddev_us\":%.2f", r->std_dev);
+    fprintf(fp, ",\"min_us\":%.2f", r->min);
+    fprintf(fp, ",\"max_us\":%.2f", r->max);
+    fprintf(fp, ",\"p95_us\":%.2f", r->p95);
+    fprintf(fp, ",\"p99_us\":%.2f", r->p99);
+    fprintf(fp, ",\"p999_us\":%.2f", r->p999);
+    fprintf(fp, ",\"p9999_us\":%.2f", r->p9999);
+    fprintf(fp, ",\"batch_size\":%d", r->batch_size);
+    fprintf(fp, ",\"throughput_ops_sec\":%.2f", r->throughput_ops_sec);
+    fprintf(fp, ",\"ns_per_op\":%.2f", r->amortized_ns_op);
+
+    if (r->ci_half_width_rel > 0.0) {
+        fprintf(fp, ",\"ci_converged\":%s", r->ci_converged ? "true" : "false");
+        fprintf(fp, ",\"ci_half_width_rel\":%.4f", r->ci_half_width_rel);
+    }
+
+    if (r->perf_valid) {
+        fprintf(fp, ",\"perf\":{\"cycles_per_op\":%.1f"
+                    ",\"instructions_per_op\":%.1f,\"ipc\":%.3f"
+                    ",\"l1d_mpki\":%.3f,\"llc_mpki\":%.3f"
+                    ",\"branch_mpki\":%.3f}",
+                r->cycles_per_op, r->instructions_per_op, r->ipc,
+                r->l1d_mpki, r->llc_mpki, r->branch_mpki);
+    }
+
+    if (r->telemetry_valid) {
+        fprintf(fp, ",\"telemetry\":{\"freq_mean_mhz\":%.1f"
+                    ",\"freq_min_mhz\":%.1f,\"freq_max_mhz\":%.1f"
+                    ",\"temp_max_c\":%.1f,\"throttled\":%s}",
+                r->freq_mean_mhz, r->freq_min_mhz, r->freq_max_mhz,
+                r->temp_max_c, r->freq_throttled ? "true" : "false");
+    }
+
+    if (r->regression_checked) {
+        fprintf(fp, ",\"baseline\":{\"median_us\":%.2f"
+                    ",\"median_delta_pct\":%.2f,\"z_score\":%.2f"
+                    ",\"regressed\":%s}",
+                r->baseline_median, r->median_delta * 100.0,
+                r->regression_z, r->regressed ? "true" : "false");
+    }
+
+    if (include_samples && r->samples != NULL && r->num_samples > 0) {
+        fprintf(fp, ",\"samples_ns\":[");
+        for (int i = 0; i < r->num_samples; i++) {
+            fprintf(fp, "%s%llu", (i > 0) ? "," : "",
+                    (unsigned long long)r->samples[i]);
+        }
+        fprintf(fp, "]");
+    }
+
+    fprintf(fp, "}\n");
+}
+
+int pqc_result_stream_open(pqc_result_stream_t *stream, const char *path,
+                          pqc_result_stream_format_t format,
+                          bool include_samples) {
+    if (stream == NULL || path == NULL) {
+        LOG_ERROR("NULL parameter in result_stream_open");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->format = format;
+
+    if (include_samples && format == PQC_STREAM_FORMAT_CSV) {
+        LOG_WARN("Raw samples are only embedded in JSONL streams, ignored");
+    } else {
+        stream->include_samples = include_samples;
+    }
+
+    stream->buf = (char*)malloc(PQC_RESULT_STREAM_BUF_SIZE);
+    if (stream->buf == NULL) {
+        LOG_ERROR("Failed to allocate stream buffer");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    stream->fp = fopen(path, "w");
+    if (stream->fp == NULL) {
+        LOG_ERROR("Failed to open stream file: %s", path);
+        free(stream->buf);
+        stream->buf = NULL;
+        return PQC_ERROR_IO;
+    }
+
+    // Records accumulate here and leave as one write per flush, which
+    // matters on network filesystems
+    setvbuf(stream->fp, stream->buf, _IOFBF, PQC_RESULT_STREAM_BUF_SIZE);
+
+    pthread_mutex_init(&stream->lock, NULL);
+
+    LOG_INFO("Streaming %s records to %s",
+             (format == PQC_STREAM_FORMAT_CSV) ? "CSV" : "JSONL", path);
+
+    return PQC_SUCCESS;
+}
+
+int pqc_result_stream_append(pqc_result_stream_t *stream,
+                            const BenchmarkResult *result) {
+    if (stream == NULL || result == NULL) {
+        LOG_ERROR("NULL parameter in result_stream_append");
+        return PQC_ERROR_NULL_POINTER;
+    }
+    if (stream->fp == NULL) {
+        LOG_ERROR("result_stream_append on a closed stream");
+        return PQC_ERROR_INVALID_STATE;
+    }
+
+    pthread_mutex_lock(&stream->lock);
+
+    if (stream->format == PQC_STREAM_FORMAT_CSV) {
+        if (!stream->header_written) {
+            csv_write_header(stream->fp);
+            stream->header_written = true;
+        }
+        csv_write_row(stream->fp, result, result->algorithm,
+                      result->architecture);
+    } else {
+        jsonl_write_record(stream->fp, result, stream->include_samples);
+    }
+
+    // Per-record flush is the crash guarantee: every line already in the
+    // file is a complete record
+    int ret = PQC_SUCCESS;
+    if (fflush(stream->fp) != 0 || ferror(stream->fp)) {
+        ret = PQC_ERROR_IO;
+    } else {
+        stream->records_written++;
+    }
+
+    pthread_mutex_unlock(&stream->lock);
+
+    return ret;
+}
+
+int pqc_result_stream_close(pqc_result_stream_t *stream) {
+    if (stream == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+    if (stream->fp == NULL) {
+        return PQC_SUCCESS;
+    }
+
+    int ret = PQC_SUCCESS;
+    if (fflush(stream->fp) != 0 || ferror(stream->fp)) {
+        ret = PQC_ERROR_IO;
+    }
+    fclose(stream->fp);
+    stream->fp = NULL;
+
+    free(stream->buf);
+    stream->buf = NULL;
+    pthread_mutex_destroy(&stream->lock);
+
+    LOG_INFO("Result stream closed after %d records", stream->records_written);
+
+    return ret;
+}
+
 // ============================================================================
 // Utility Functions
 // ============================================================================
@@ -0,0 +1,312 @@
+/**
+ * @file keypair_corpus.c
+ * @brief Implementation of the memory-mapped keypair corpus
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#include "keypair_corpus.h"
+#include "../core/error_codes.h"
+#include "../utils/logger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Message signed by every signature corpus entry
+static const char CORPUS_MESSAGE[] = "Test message for signing";
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+/**
+ * @brief Build the corpus file path for an algorithm
+ */
+static void corpus_path(char *buf, size_t buf_size, const char *dir,
+                        const char *alg_name) {
+    snprintf(buf, buf_size, "%s/%s.corpus", dir, alg_name);
+}
+
+/**
+ * @brief Bytes per corpus record for an algorithm
+ */
+static size_t corpus_entry_size(const PQCAlgorithm *alg) {
+    if (pqc_algorithm_is_kem(alg)) {
+        return alg->pk_len + alg->sk_len + alg->ct_len + alg->ss_len;
+    }
+    // pk || sk || uint64_t actual signature length || padded signature
+    return alg->pk_len + alg->sk_len + sizeof(uint64_t) + alg->sig_len;
+}
+
+/**
+ * @brief Check that a mapped header matches the algorithm's layout
+ */
+static int corpus_header_matches(const pqc_corpus_file_header_t *header,
+                                 const PQCAlgorithm *alg) {
+    if (memcmp(header->magic, PQC_CORPUS_FILE_MAGIC,
+               sizeof(header->magic)) != 0) {
+        return 0;
+    }
+
+    if (strncmp(header->algorithm, alg->name,
+                sizeof(header->algorithm)) != 0) {
+        return 0;
+    }
+
+    return header->num_entries > 0 &&
+           header->pk_len == alg->pk_len &&
+           header->sk_len == alg->sk_len &&
+           header->ct_len == alg->ct_len &&
+           header->ss_len == alg->ss_len &&
+           header->sig_len == alg->sig_len;
+}
+
+// ============================================================================
+// Corpus Functions
+// ============================================================================
+
+int pqc_keypair_corpus_generate(const PQCAlgorithm *alg, const char *dir,
+                                int num_entries) {
+    if (alg == NULL || dir == NULL) {
+        LOG_ERROR("NULL parameter in corpus_generate");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    if (num_entries <= 0) {
+        num_entries = PQC_CORPUS_DEFAULT_ENTRIES;
+    }
+
+    int is_kem = pqc_algorithm_is_kem(alg);
+    size_t entry_size = corpus_entry_size(alg);
+    size_t msg_len = is_kem ? 0 : strlen(CORPUS_MESSAGE);
+
+    uint8_t *entry = (uint8_t*)malloc(entry_size);
+    if (entry == NULL) {
+        LOG_ERROR("Failed to allocate corpus entry buffer");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    char path[512];
+    corpus_path(path, sizeof(path), dir, alg->name);
+
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        LOG_ERROR("Failed to open corpus file: %s (%s)", path, strerror(errno));
+        free(entry);
+        return PQC_ERROR_IO;
+    }
+
+    pqc_corpus_file_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PQC_CORPUS_FILE_MAGIC, sizeof(header.magic));
+    header.header_size = (uint32_t)sizeof(header);
+    header.num_entries = (uint32_t)num_entries;
+    header.pk_len = alg->pk_len;
+    header.sk_len = alg->sk_len;
+    header.ct_len = alg->ct_len;
+    header.ss_len = alg->ss_len;
+    header.sig_len = alg->sig_len;
+    header.msg_len = msg_len;
+    snprintf(header.algorithm, sizeof(header.algorithm), "%s", alg->name);
+
+    if (fwrite(&header, sizeof(header), 1, fp) != 1 ||
+        (msg_len > 0 && fwrite(CORPUS_MESSAGE, 1, msg_len, fp) != msg_len)) {
+        LOG_ERROR("Failed to write corpus header to %s", path);
+        goto io_error;
+    }
+
+    LOG_INFO("Generating %d-entry corpus for %s", num_entries, alg->name);
+
+    for (int i = 0; i < num_entries; i++) {
+        uint8_t *pk = entry;
+        uint8_t *sk = pk + alg->pk_len;
+
+        if (alg->keygen(alg, pk, sk) != 0) {
+            LOG_ERROR("Keygen failed during corpus generation (%s)", alg->name);
+            goto op_error;
+        }
+
+        if (is_kem) {
+            uint8_t *ct = sk + alg->sk_len;
+            uint8_t *ss = ct + alg->ct_len;
+
+            if (alg->encaps(alg, ct, ss, pk) != 0) {
+                LOG_ERROR("Encaps failed during corpus generation (%s)",
+                          alg->name);
+                goto op_error;
+            }
+        } else {
+            uint8_t *sig_len_field = sk + alg->sk_len;
+            uint8_t *sig = sig_len_field + sizeof(uint64_t);
+            size_t sig_len = alg->sig_len;
+
+            // Pad the signature region so records stay fixed-size
+            memset(sig, 0, alg->sig_len);
+
+            if (alg->sign(alg, sig, &sig_len, (const uint8_t*)CORPUS_MESSAGE,
+                          msg_len, sk) != 0) {
+                LOG_ERROR("Sign failed during corpus generation (%s)",
+                          alg->name);
+                goto op_error;
+            }
+
+            uint64_t stored_len = (uint64_t)sig_len;
+            memcpy(sig_len_field, &stored_len, sizeof(stored_len));
+        }
+
+        if (fwrite(entry, 1, entry_size, fp) != entry_size) {
+            LOG_ERROR("Failed to write corpus entry to %s", path);
+            goto io_error;
+        }
+    }
+
+    free(entry);
+    fclose(fp);
+
+    LOG_INFO("Wrote keypair corpus to %s", path);
+
+    return PQC_SUCCESS;
+
+op_error:
+    free(entry);
+    fclose(fp);
+    remove(path);
+    return PQC_ERROR_OPERATION_FAILED;
+
+io_error:
+    free(entry);
+    fclose(fp);
+    remove(path);
+    return PQC_ERROR_IO;
+}
+
+int pqc_keypair_corpus_open(pqc_keypair_corpus_t *corpus,
+                            const PQCAlgorithm *alg, const char *dir) {
+    if (corpus == NULL || alg == NULL || dir == NULL) {
+        LOG_ERROR("NULL parameter in corpus_open");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    memset(corpus, 0, sizeof(*corpus));
+
+    char path[512];
+    corpus_path(path, sizeof(path), dir, alg->name);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        LOG_DEBUG("No corpus file at %s (%s)", path, strerror(errno));
+        return PQC_ERROR_IO;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(pqc_corpus_file_header_t)) {
+        LOG_ERROR("Corpus file %s is truncated", path);
+        close(fd);
+        return PQC_ERROR_INVALID_STATE;
+    }
+
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED) {
+        LOG_ERROR("Failed to map corpus file %s: %s", path, strerror(errno));
+        return PQC_ERROR_IO;
+    }
+
+    const pqc_corpus_file_header_t *header =
+        (const pqc_corpus_file_header_t*)map;
+
+    size_t entry_size = corpus_entry_size(alg);
+    size_t expected_size = sizeof(*header) + header->msg_len +
+                           (size_t)header->num_entries * entry_size;
+
+    if (!corpus_header_matches(header, alg) ||
+        (size_t)st.st_size < expected_size) {
+        LOG_WARN("Corpus file %s does not match %s (stale?)", path, alg->name);
+        munmap(map, (size_t)st.st_size);
+        return PQC_ERROR_INVALID_STATE;
+    }
+
+    corpus->header = header;
+    corpus->map = (const uint8_t*)map;
+    corpus->map_len = (size_t)st.st_size;
+    corpus->entry_size = entry_size;
+
+    LOG_DEBUG("Mapped corpus %s: %u entries, %zu bytes",
+              path, header->num_entries, corpus->map_len);
+
+    return PQC_SUCCESS;
+}
+
+int pqc_keypair_corpus_ensure(pqc_keypair_corpus_t *corpus,
+                              const PQCAlgorithm *alg, const char *dir) {
+    int ret = pqc_keypair_corpus_open(corpus, alg, dir);
+    if (ret == PQC_SUCCESS) {
+        return PQC_SUCCESS;
+    }
+
+    // Missing or stale: regenerate once, then map the fresh file
+    ret = pqc_keypair_corpus_generate(alg, dir, PQC_CORPUS_DEFAULT_ENTRIES);
+    if (ret != PQC_SUCCESS) {
+        return ret;
+    }
+
+    return pqc_keypair_corpus_open(corpus, alg, dir);
+}
+
+int pqc_keypair_corpus_entry(const pqc_keypair_corpus_t *corpus, int index,
+                             pqc_corpus_entry_t *entry) {
+    if (corpus == NULL || corpus->header == NULL || entry == NULL) {
+        LOG_ERROR("NULL parameter in corpus_entry");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    if (index < 0) {
+        LOG_ERROR("Invalid corpus entry index: %d", index);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    const pqc_corpus_file_header_t *header = corpus->header;
+
+    memset(entry, 0, sizeof(*entry));
+
+    const uint8_t *msg = corpus->map + header->header_size;
+    const uint8_t *records = msg + header->msg_len;
+    const uint8_t *record = records +
+        (size_t)(index % (int)header->num_entries) * corpus->entry_size;
+
+    entry->pk = record;
+    entry->sk = entry->pk + header->pk_len;
+
+    if (header->ct_len > 0) {
+        // KEM record: pk || sk || ct || ss
+        entry->ct = entry->sk + header->sk_len;
+        entry->ss = entry->ct + header->ct_len;
+    } else {
+        // Signature record: pk || sk || sig_len || sig, plus shared message
+        const uint8_t *sig_len_field = entry->sk + header->sk_len;
+        uint64_t sig_len;
+        memcpy(&sig_len, sig_len_field, sizeof(sig_len));
+
+        entry->sig = sig_len_field + sizeof(uint64_t);
+        entry->sig_len = (size_t)sig_len;
+        entry->msg = msg;
+        entry->msg_len = (size_t)header->msg_len;
+    }
+
+    return PQC_SUCCESS;
+}
+
+void pqc_keypair_corpus_close(pqc_keypair_corpus_t *corpus) {
+    if (corpus == NULL || corpus->map == NULL) {
+        return;
+    }
+
+    munmap((void*)corpus->map, corpus->map_len);
+    memset(corpus, 0, sizeof(*corpus));
+}
@@ -0,0 +1,147 @@
+/**
+ * @file keypair_corpus.h
+ * @brief Persistent memory-mapped corpus of pre-generated test material
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Benchmarking encaps/decaps/sign/verify needs a valid keypair (and a
+ * matching ciphertext or signature) before measurement can start. This
+ * module generates that material once per algorithm, persists it to a
+ * corpus file, and memory-maps it read-only on later runs so the full
+ * suite cold-starts with an mmap instead of repeated setup keygen.
+ */
+
+#ifndef PQC_KEYPAIR_CORPUS_H
+#define PQC_KEYPAIR_CORPUS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../core/algorithm_interface.h"
+
+// ============================================================================
+// Corpus File Format
+// ============================================================================
+
+/**
+ * @brief File magic identifying a keypair corpus (not NUL-terminated)
+ */
+#define PQC_CORPUS_FILE_MAGIC "PQCCORP1"
+
+/**
+ * @brief Default number of entries generated per algorithm
+ */
+#define PQC_CORPUS_DEFAULT_ENTRIES 8
+
+/**
+ * @brief On-disk header of a keypair corpus file
+ *
+ * The file is this header, followed by msg_len bytes of shared message
+ * (signature corpora only), followed by num_entries fixed-size records:
+ * pk || sk || ct || ss for KEMs, or pk || sk || uint64_t sig_len || sig
+ * (padded to the algorithm's maximum signature length) for signatures.
+ */
+typedef struct {
+    char     magic[8];         ///< PQC_CORPUS_FILE_MAGIC
+    uint32_t header_size;      ///< Byte offset of the message block
+    uint32_t num_entries;      ///< Number of records in the file
+    uint64_t pk_len;           ///< Public key length in bytes
+    uint64_t sk_len;           ///< Secret key length in bytes
+    uint64_t ct_len;           ///< Ciphertext length (0 for signatures)
+    uint64_t ss_len;           ///< Shared secret length (0 for signatures)
+    uint64_t sig_len;          ///< Maximum signature length (0 for KEMs)
+    uint64_t msg_len;          ///< Shared message length (0 for KEMs)
+    char     algorithm[32];    ///< NUL-terminated algorithm name
+} pqc_corpus_file_header_t;
+
+// ============================================================================
+// Data Types
+// ============================================================================
+
+/**
+ * @brief An open, memory-mapped keypair corpus
+ */
+typedef struct {
+    const pqc_corpus_file_header_t *header;  ///< Mapped file header
+    const uint8_t *map;                      ///< Start of the mapping
+    size_t map_len;                          ///< Length of the mapping
+    size_t entry_size;                       ///< Bytes per record
+} pqc_keypair_corpus_t;
+
+/**
+ * @brief Pointers into one corpus record (valid while the corpus is open)
+ *
+ * Fields not applicable to the algorithm type are NULL/0.
+ */
+typedef struct {
+    const uint8_t *pk;         ///< Public key
+    const uint8_t *sk;         ///< Secret key
+    const uint8_t *ct;         ///< Ciphertext (KEM)
+    const uint8_t *ss;         ///< Shared secret (KEM)
+    const uint8_t *sig;        ///< Signature (Signature)
+    size_t sig_len;            ///< Actual signature length (Signature)
+    const uint8_t *msg;        ///< Signed message (Signature)
+    size_t msg_len;            ///< Message length (Signature)
+} pqc_corpus_entry_t;
+
+// ============================================================================
+// Corpus Functions
+// ============================================================================
+
+/**
+ * @brief Generate a corpus file for an algorithm
+ * @param alg Algorithm to generate material for
+ * @param dir Directory for the corpus file (must exist)
+ * @param num_entries Records to generate (<= 0 uses PQC_CORPUS_DEFAULT_ENTRIES)
+ * @return 0 on success, negative error code on failure
+ *
+ * Writes "<dir>/<alg->name>.corpus", overwriting any existing file. For
+ * KEMs each record is a keypair with a matching ciphertext and shared
+ * secret; for signatures it is a keypair with a signature over the
+ * corpus message.
+ */
+int pqc_keypair_corpus_generate(const PQCAlgorithm *alg, const char *dir,
+                                int num_entries);
+
+/**
+ * @brief Open an algorithm's corpus file read-only via mmap
+ * @param corpus Corpus handle to initialize
+ * @param alg Algorithm the corpus must match (name and buffer lengths)
+ * @param dir Directory holding the corpus file
+ * @return 0 on success, negative error code on failure
+ *
+ * Fails with PQC_ERROR_IO if the file does not exist and with
+ * PQC_ERROR_INVALID_STATE if it exists but does not match the algorithm
+ * (e.g., generated against a different liboqs build).
+ */
+int pqc_keypair_corpus_open(pqc_keypair_corpus_t *corpus,
+                            const PQCAlgorithm *alg, const char *dir);
+
+/**
+ * @brief Open a corpus, generating it first if missing or stale
+ * @param corpus Corpus handle to initialize
+ * @param alg Algorithm the corpus must match
+ * @param dir Directory for the corpus file (must exist)
+ * @return 0 on success, negative error code on failure
+ *
+ * The first run pays the generation cost once; every later run reduces
+ * to the mmap in pqc_keypair_corpus_open().
+ */
+int pqc_keypair_corpus_ensure(pqc_keypair_corpus_t *corpus,
+                              const PQCAlgorithm *alg, const char *dir);
+
+/**
+ * @brief Resolve one record of an open corpus
+ * @param corpus Open corpus handle
+ * @param index Record index (wraps modulo the number of entries)
+ * @param entry Output: pointers into the mapping
+ * @return 0 on success, negative error code on failure
+ */
+int pqc_keypair_corpus_entry(const pqc_keypair_corpus_t *corpus, int index,
+                             pqc_corpus_entry_t *entry);
+
+/**
+ * @brief Unmap and close a corpus (may be called on a zeroed handle)
+ */
+void pqc_keypair_corpus_close(pqc_keypair_corpus_t *corpus);
+
+#endif // PQC_KEYPAIR_CORPUS_H
@@ -0,0 +1,418 @@
+/**
+ * @file measure_memory.c
+ * @brief Per-operation memory footprint measurement for ML-KEM and ML-DSA
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Companion to measure_sizes: where that tool reports the static artifact
+ * sizes (keys, ciphertexts, signatures), this one reports the transient
+ * memory each operation needs while it runs - peak stack usage and the heap
+ * high-water mark - so deployments on constrained workers (small thread
+ * stacks, embedded heaps) can be sized from data rather than guesswork.
+ *
+ * Each operation runs once per measurement on a dedicated pattern-filled
+ * stack (see utils/memory_profiler.h); input/output buffers are allocated
+ * outside the profiled call so only the algorithm's own footprint is
+ * counted. Results are printed as a table and optionally exported to
+ * JSON/CSV alongside the measure_sizes output.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "../adapters/liboqs_adapter.h"
+#include "../core/error_codes.h"
+#include "../utils/logger.h"
+#include "../utils/memory_profiler.h"
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+#define DEFAULT_STACK_KB 512
+#define SIGN_MESSAGE_BYTES 64
+#define MAX_PROFILE_ROWS 32
+
+static const char *MLKEM_ALGORITHMS[] = { "mlkem512", "mlkem768", "mlkem1024" };
+static const char *MLDSA_ALGORITHMS[] = { "mldsa44", "mldsa65", "mldsa87" };
+
+#define NUM_MLKEM (int)(sizeof(MLKEM_ALGORITHMS) / sizeof(MLKEM_ALGORITHMS[0]))
+#define NUM_MLDSA (int)(sizeof(MLDSA_ALGORITHMS) / sizeof(MLDSA_ALGORITHMS[0]))
+
+// ============================================================================
+// Result Record
+// ============================================================================
+
+/**
+ * @brief Memory footprint of one algorithm/operation pair
+ */
+typedef struct {
+    char algorithm[64];            ///< Algorithm name (e.g., "mlkem768")
+    char operation[16];            ///< Operation name (e.g., "encaps")
+    size_t stack_peak_bytes;       ///< Peak stack usage
+    size_t heap_peak_bytes;        ///< Peak live heap during the call
+    size_t heap_alloc_count;       ///< Heap allocations during the call
+} MemoryProfileInfo;
+
+// ============================================================================
+// Profiled Operation Thunks
+// ============================================================================
+
+/**
+ * @brief Buffers shared by the operation thunks
+ *
+ * Everything the operations read or write is allocated here, before
+ * profiling starts, so the profiled call only accounts the algorithm's
+ * internal usage.
+ */
+typedef struct {
+    const PQCAlgorithm *alg;       ///< Algorithm under measurement
+    uint8_t *pk;                   ///< Public key
+    uint8_t *sk;                   ///< Secret key
+    uint8_t *ct;                   ///< Ciphertext (KEM)
+    uint8_t *ss;                   ///< Shared secret (KEM)
+    uint8_t *sig;                  ///< Signature (DSA)
+    size_t sig_len;                ///< Actual signature length (DSA)
+    uint8_t msg[SIGN_MESSAGE_BYTES]; ///< Message to sign/verify (DSA)
+} op_buffers_t;
+
+static int thunk_keygen(void *p) {
+    op_buffers_t *b = (op_buffers_t *)p;
+    return b->alg->keygen(b->alg, b->pk, b->sk);
+}
+
+static int thunk_encaps(void *p) {
+    op_buffers_t *b = (op_buffers_t *)p;
+    return b->alg->encaps(b->alg, b->ct, b->ss, b->pk);
+}
+
+static int thunk_decaps(void *p) {
+    op_buffers_t *b = (op_buffers_t *)p;
+    return b->alg->decaps(b->alg, b->ss, b->ct, b->sk);
+}
+
+static int thunk_sign(void *p) {
+    op_buffers_t *b = (op_buffers_t *)p;
+    return b->alg->sign(b->alg, b->sig, &b->sig_len,
+                        b->msg, SIGN_MESSAGE_BYTES, b->sk);
+}
+
+static int thunk_verify(void *p) {
+    op_buffers_t *b = (op_buffers_t *)p;
+    return b->alg->verify(b->alg, b->msg, SIGN_MESSAGE_BYTES,
+                          b->sig, b->sig_len, b->pk);
+}
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+static int profile_one_operation(op_buffers_t *buffers, const char *operation,
+                                 int (*thunk)(void *), size_t stack_size,
+                                 MemoryProfileInfo *row) {
+    pqc_memory_profile_t profile;
+    int ret = pqc_memory_profile_call(thunk, buffers, stack_size, &profile);
+    if (ret != PQC_SUCCESS) {
+        LOG_ERROR("%s/%s failed during profiling (code %d)",
+                  buffers->alg->name, operation, ret);
+        return ret;
+    }
+
+    snprintf(row->algorithm, sizeof(row->algorithm), "%s", buffers->alg->name);
+    snprintf(row->operation, sizeof(row->operation), "%s", operation);
+    row->stack_peak_bytes = profile.stack_peak_bytes;
+    row->heap_peak_bytes = profile.heap_peak_bytes;
+    row->heap_alloc_count = profile.heap_alloc_count;
+    return PQC_SUCCESS;
+}
+
+static int alloc_key_buffers(op_buffers_t *buffers, const PQCAlgorithm *alg) {
+    memset(buffers, 0, sizeof(*buffers));
+    buffers->alg = alg;
+    buffers->pk = malloc(alg->pk_len);
+    buffers->sk = malloc(alg->sk_len);
+    if (buffers->pk == NULL || buffers->sk == NULL) {
+        LOG_ERROR("Failed to allocate key buffers for %s", alg->name);
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+    return PQC_SUCCESS;
+}
+
+static void free_op_buffers(op_buffers_t *buffers) {
+    free(buffers->pk);
+    free(buffers->sk);
+    free(buffers->ct);
+    free(buffers->ss);
+    free(buffers->sig);
+}
+
+/**
+ * @brief Profile keygen/encaps/decaps for one ML-KEM variant
+ * @return Number of rows appended, or negative error code
+ */
+static int measure_kem_memory(const char *name, size_t stack_size,
+                              MemoryProfileInfo *rows) {
+    PQCAlgorithm *alg = liboqs_create_kem_algorithm(name);
+    if (alg == NULL) {
+        LOG_ERROR("Failed to create KEM algorithm %s", name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    op_buffers_t buffers;
+    int ret = alloc_key_buffers(&buffers, alg);
+    if (ret == PQC_SUCCESS) {
+        buffers.ct = malloc(alg->ct_len);
+        buffers.ss = malloc(alg->ss_len);
+        if (buffers.ct == NULL || buffers.ss == NULL) {
+            LOG_ERROR("Failed to allocate KEM buffers for %s", name);
+            ret = PQC_ERROR_MEMORY_ALLOC;
+        }
+    }
+
+    int num_rows = 0;
+    if (ret == PQC_SUCCESS) {
+        ret = profile_one_operation(&buffers, "keygen", thunk_keygen,
+                                    stack_size, &rows[num_rows]);
+    }
+    if (ret == PQC_SUCCESS) {
+        num_rows++;
+        ret = profile_one_operation(&buffers, "encaps", thunk_encaps,
+                                    stack_size, &rows[num_rows]);
+    }
+    if (ret == PQC_SUCCESS) {
+        num_rows++;
+        ret = profile_one_operation(&buffers, "decaps", thunk_decaps,
+                                    stack_size, &rows[num_rows]);
+    }
+    if (ret == PQC_SUCCESS) {
+        num_rows++;
+    }
+
+    free_op_buffers(&buffers);
+    liboqs_destroy_algorithm(alg);
+    return ret == PQC_SUCCESS ? num_rows : ret;
+}
+
+/**
+ * @brief Profile keygen/sign/verify for one ML-DSA variant
+ * @return Number of rows appended, or negative error code
+ */
+static int measure_dsa_memory(const char *name, size_t stack_size,
+                              MemoryProfileInfo *rows) {
+    PQCAlgorithm *alg = liboqs_create_sig_algorithm(name);
+    if (alg == NULL) {
+        LOG_ERROR("Failed to create signature algorithm %s", name);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    op_buffers_t buffers;
+    int ret = alloc_key_buffers(&buffers, alg);
+    if (ret == PQC_SUCCESS) {
+        buffers.sig = malloc(alg->sig_len);
+        if (buffers.sig == NULL) {
+            LOG_ERROR("Failed to allocate signature buffer for %s", name);
+            ret = PQC_ERROR_MEMORY_ALLOC;
+        }
+        for (int i = 0; i < SIGN_MESSAGE_BYTES; i++) {
+            buffers.msg[i] = (uint8_t)(i * 37 + 11);
+        }
+    }
+
+    int num_rows = 0;
+    if (ret == PQC_SUCCESS) {
+        ret = profile_one_operation(&buffers, "keygen", thunk_keygen,
+                                    stack_size, &rows[num_rows]);
+    }
+    if (ret == PQC_SUCCESS) {
+        num_rows++;
+        ret = profile_one_operation(&buffers, "sign", thunk_sign,
+                                    stack_size, &rows[num_rows]);
+    }
+    if (ret == PQC_SUCCESS) {
+        num_rows++;
+        ret = profile_one_operation(&buffers, "verify", thunk_verify,
+                                    stack_size, &rows[num_rows]);
+    }
+    if (ret == PQC_SUCCESS) {
+        num_rows++;
+    }
+
+    free_op_buffers(&buffers);
+    liboqs_destroy_algorithm(alg);
+    return ret == PQC_SUCCESS ? num_rows : ret;
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+static void print_profile_table(const MemoryProfileInfo *rows, int num_rows,
+                                size_t stack_size) {
+    printf("\n");
+    printf("┌──────────────┬────────────┬──────────────┬──────────────┬────────┐\n");
+    printf("│ Algorithm    │ Operation  │ Stack peak   │ Heap peak    │ Allocs │\n");
+    printf("├──────────────┼────────────┼──────────────┼──────────────┼────────┤\n");
+    for (int i = 0; i < num_rows; i++) {
+        printf("│ %-12s │ %-10s │ %9zu B  │ %9zu B  │ %6zu │\n",
+               rows[i].algorithm, rows[i].operation,
+               rows[i].stack_peak_bytes, rows[i].heap_peak_bytes,
+               rows[i].heap_alloc_count);
+    }
+    printf("└──────────────┴────────────┴──────────────┴──────────────┴────────┘\n");
+    printf("Profiled with a %zu KB thread stack; stack peaks include a few KB\n"
+           "of constant per-thread TLS overhead placed at the top of the stack.\n\n",
+           stack_size / 1024);
+}
+
+static int export_profiles_json(const char *path, const MemoryProfileInfo *rows,
+                                int num_rows, size_t stack_size) {
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        LOG_ERROR("Failed to open %s for writing", path);
+        return PQC_ERROR_IO;
+    }
+    fprintf(f, "{\n  \"stack_size_bytes\": %zu,\n  \"operations\": [\n",
+            stack_size);
+    for (int i = 0; i < num_rows; i++) {
+        fprintf(f,
+                "    {\"algorithm\": \"%s\", \"operation\": \"%s\", "
+                "\"stack_peak_bytes\": %zu, \"heap_peak_bytes\": %zu, "
+                "\"heap_alloc_count\": %zu}%s\n",
+                rows[i].algorithm, rows[i].operation,
+                rows[i].stack_peak_bytes, rows[i].heap_peak_bytes,
+                rows[i].heap_alloc_count,
+                i + 1 < num_rows ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    LOG_INFO("Memory profiles exported to %s", path);
+    return PQC_SUCCESS;
+}
+
+static int export_profiles_csv(const char *path, const MemoryProfileInfo *rows,
+                               int num_rows, size_t stack_size) {
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        LOG_ERROR("Failed to open %s for writing", path);
+        return PQC_ERROR_IO;
+    }
+    fprintf(f, "algorithm,operation,stack_peak_bytes,heap_peak_bytes,"
+               "heap_alloc_count,stack_size_bytes\n");
+    for (int i = 0; i < num_rows; i++) {
+        fprintf(f, "%s,%s,%zu,%zu,%zu,%zu\n",
+                rows[i].algorithm, rows[i].operation,
+                rows[i].stack_peak_bytes, rows[i].heap_peak_bytes,
+                rows[i].heap_alloc_count, stack_size);
+    }
+    fclose(f);
+    LOG_INFO("Memory profiles exported to %s", path);
+    return PQC_SUCCESS;
+}
+
+// ============================================================================
+// Command-line Interface
+// ============================================================================
+
+static void print_usage(const char *prog) {
+    printf("Usage: %s [OPTIONS]\n", prog);
+    printf("\nMeasure per-operation peak stack and heap usage for ML-KEM and ML-DSA.\n");
+    printf("\nOptions:\n");
+    printf("  -s SIZE_KB   Thread stack size in KB (default: %d)\n",
+           DEFAULT_STACK_KB);
+    printf("  -j FILE      Export results to JSON file\n");
+    printf("  -c FILE      Export results to CSV file\n");
+    printf("  -k           Measure KEM algorithms only\n");
+    printf("  -d           Measure signature algorithms only\n");
+    printf("  -h           Show this help\n");
+    printf("\nExample:\n");
+    printf("  %s -s 128 -j results/data/memory_profiles.json\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    size_t stack_kb = DEFAULT_STACK_KB;
+    const char *json_path = NULL;
+    const char *csv_path = NULL;
+    int kem_only = 0;
+    int dsa_only = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:j:c:kdh")) != -1) {
+        switch (opt) {
+            case 's':
+                stack_kb = (size_t)atol(optarg);
+                if (stack_kb == 0) {
+                    fprintf(stderr, "Invalid stack size: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'j': json_path = optarg; break;
+            case 'c': csv_path = optarg; break;
+            case 'k': kem_only = 1; break;
+            case 'd': dsa_only = 1; break;
+            case 'h': print_usage(argv[0]); return 0;
+            default:  print_usage(argv[0]); return 1;
+        }
+    }
+
+    logger_config_t log_config = {
+        .min_level = LOG_LEVEL_INFO,
+        .file_output = NULL,
+        .use_colors = 1,
+        .include_timestamp = 0,
+        .include_source_info = 0
+    };
+    logger_init(log_config);
+
+    if (!pqc_memory_heap_tracking_available()) {
+        LOG_WARN("Heap tracking unavailable on this libc; "
+                 "heap columns will read zero");
+    }
+
+    size_t stack_size = stack_kb * 1024;
+    MemoryProfileInfo rows[MAX_PROFILE_ROWS];
+    int num_rows = 0;
+    int failed = 0;
+
+    if (!dsa_only) {
+        for (int i = 0; i < NUM_MLKEM; i++) {
+            int added = measure_kem_memory(MLKEM_ALGORITHMS[i], stack_size,
+                                           &rows[num_rows]);
+            if (added < 0) {
+                failed++;
+            } else {
+                num_rows += added;
+            }
+        }
+    }
+    if (!kem_only) {
+        for (int i = 0; i < NUM_MLDSA; i++) {
+            int added = measure_dsa_memory(MLDSA_ALGORITHMS[i], stack_size,
+                                           &rows[num_rows]);
+            if (added < 0) {
+                failed++;
+            } else {
+                num_rows += added;
+            }
+        }
+    }
+
+    if (num_rows == 0) {
+        LOG_ERROR("No operations could be profiled");
+        return 1;
+    }
+
+    print_profile_table(rows, num_rows, stack_size);
+
+    if (json_path != NULL &&
+        export_profiles_json(json_path, rows, num_rows, stack_size) != PQC_SUCCESS) {
+        failed++;
+    }
+    if (csv_path != NULL &&
+        export_profiles_csv(csv_path, rows, num_rows, stack_size) != PQC_SUCCESS) {
+        failed++;
+    }
+
+    return failed > 0 ? 1 : 0;
+}
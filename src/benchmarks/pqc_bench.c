@@ -0,0 +1,663 @@
+/**
+ * @file pqc_bench.c
+ * @brief Unified benchmark runner for all supported PQC algorithms
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Single-binary replacement for the per-family drivers: takes an algorithm
+ * list (or "all") on the command line, runs every selected algorithm in one
+ * process with shared provider state, and emits one consolidated
+ * BenchmarkResultSet per run. One process, one liboqs init, one output file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "generic_benchmark.h"
+#include "../adapters/liboqs_adapter.h"
+#include "../adapters/liboqs_direct.h"
+#include "../adapters/openssl_adapter.h"
+#include "../utils/logger.h"
+#include "../utils/results_store.h"
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+#define DEFAULT_ITERATIONS 1000
+#define DEFAULT_WARMUP_ITERATIONS 100
+#define OUTLIER_MULTIPLIER 1.5
+#define MAX_MESSAGE_SIZES 16
+#define MAX_SELECTED_ALGORITHMS 16
+#define MAX_PROCESS_COUNTS 16
+
+// ============================================================================
+// Command-line Interface
+// ============================================================================
+
+typedef struct {
+    int iterations;
+    int warmup;
+    int adaptive_warmup;
+    int remove_outliers;
+    int verbose;
+    int parallel;
+    const char *output_json;
+    const char *output_csv;
+    const char *sample_dir;
+    const char *corpus_dir;
+    int perf_counters;
+    double adaptive_ci;
+    int max_iterations;
+    int cold_cache;
+    int pin_cpu;
+    int telemetry;
+    const char *checkpoint_dir;
+    const char *provider_name;
+    const char *stream_path;
+    const char *store_path;
+    const char *baseline_dir;
+    double regression_threshold;
+    size_t message_sizes[MAX_MESSAGE_SIZES];
+    int num_message_sizes;
+    int process_counts[MAX_PROCESS_COUNTS];
+    int num_process_counts;
+    const char *contention_op;
+    const char *interleave_op;
+    const char *algorithms[MAX_SELECTED_ALGORITHMS];
+    int num_algorithms;
+} cli_config_t;
+
+static void print_usage(const char *program_name) {
+    int count = 0;
+    const char **supported = liboqs_list_algorithms(&count);
+
+    printf("Usage: %s [options] [algorithm ...]\n", program_name);
+    printf("\nAlgorithms (default: all):\n  ");
+    for (int i = 0; i < count; i++) {
+        printf("%s%s", supported[i], (i < count - 1) ? ", " : "\n");
+    }
+    printf("\nOptions:\n");
+    printf("  -i <num>    Number of iterations (default: %d)\n", DEFAULT_ITERATIONS);
+    printf("  -w <num>    Warmup iterations (default: %d)\n", DEFAULT_WARMUP_ITERATIONS);
+    printf("  -W          Adaptive warmup: warm up until the rolling-window\n");
+    printf("              median stabilizes, instead of a fixed -w count\n");
+    printf("  -r          Remove outliers using IQR method\n");
+    printf("  -v          Verbose output\n");
+    printf("  -p <num>    Run with <num> parallel workers (default: sequential)\n");
+    printf("  -j <file>   Save consolidated results to JSON file\n");
+    printf("  -c <file>   Save consolidated results to CSV file\n");
+    printf("  -d <dir>    Dump raw timing samples as binary files in <dir>\n");
+    printf("  -k <dir>    Use (and build) a keypair corpus cache in <dir>\n");
+    printf("  -e          Sample hardware counters (cycles, IPC, cache misses)\n");
+    printf("  -a <rel>    Adaptive sampling: stop at relative CI half-width <rel>\n");
+    printf("              (e.g. 0.01 for ±1%%); -i becomes the minimum\n");
+    printf("  -m <num>    Iteration cap in adaptive mode (default: 100000)\n");
+    printf("  -s <list>   Message-size sweep for sign/verify, comma-separated bytes\n");
+    printf("              (e.g. 2048,65536,1048576)\n");
+    printf("  -C          Cold-cache mode: evict the working set before each sample\n");
+    printf("  -n <list>   Contention sweep: comma-separated process counts\n");
+    printf("              (e.g. 1,2,4,8); forks N benchmark processes per point\n");
+    printf("  -O <op>     Operation for the contention sweep\n");
+    printf("              (default: sign for signatures, decaps for KEMs)\n");
+    printf("  -I <op>     Interleave all selected algorithms on <op> in one\n");
+    printf("              loop: drift-free A/B comparison, paired samples\n");
+    printf("  -x <cpu>    Pin the measurement thread to core <cpu>\n");
+    printf("  -t          Sample core frequency and temperature during runs\n");
+    printf("  -K <dir>    Checkpoint samples to spill files in <dir>; an\n");
+    printf("              interrupted run resumes from the last marker\n");
+    printf("  -P <name>   Crypto provider: liboqs (default) or openssl\n");
+    printf("              (openssl requires OpenSSL 3.5+ at build time)\n");
+    printf("  -S <file>   Stream each operation's record to <file> as it\n");
+    printf("              completes (JSON Lines; .csv extension selects CSV)\n");
+    printf("  -R <file>   Append results to the indexed store <file> (created\n");
+    printf("              if absent); query with src/analysis/results_store.py\n");
+    printf("  -B <dir>    Gate against a baseline sample dump (written with -d):\n");
+    printf("              exit 2 when an operation's median regresses\n");
+    printf("  -T <rel>    Median slowdown that fails the -B gate\n");
+    printf("              (default: 0.05 = 5%%)\n");
+    printf("  -h          Show this help message\n");
+    printf("\n");
+}
+
+/**
+ * @brief Append an algorithm name to the selection, rejecting unknowns
+ */
+static void select_algorithm(cli_config_t *config, const char *name) {
+    if (!liboqs_supports_algorithm(name)) {
+        fprintf(stderr, "Unknown algorithm: %s\n", name);
+        exit(1);
+    }
+
+    for (int i = 0; i < config->num_algorithms; i++) {
+        if (strcmp(config->algorithms[i], name) == 0) {
+            return;  // Already selected
+        }
+    }
+
+    if (config->num_algorithms >= MAX_SELECTED_ALGORITHMS) {
+        fprintf(stderr, "Too many algorithms selected (max %d)\n",
+                MAX_SELECTED_ALGORITHMS);
+        exit(1);
+    }
+
+    config->algorithms[config->num_algorithms++] = name;
+}
+
+static void parse_args(int argc, char *argv[], cli_config_t *config) {
+    // Initialize defaults
+    config->iterations = DEFAULT_ITERATIONS;
+    config->warmup = DEFAULT_WARMUP_ITERATIONS;
+    config->adaptive_warmup = 0;
+    config->remove_outliers = 0;
+    config->verbose = 0;
+    config->parallel = 0;
+    config->output_json = NULL;
+    config->output_csv = NULL;
+    config->sample_dir = NULL;
+    config->corpus_dir = NULL;
+    config->perf_counters = 0;
+    config->adaptive_ci = 0.0;
+    config->max_iterations = 0;
+    config->cold_cache = 0;
+    config->pin_cpu = -1;
+    config->telemetry = 0;
+    config->checkpoint_dir = NULL;
+    config->provider_name = "liboqs";
+    config->stream_path = NULL;
+    config->store_path = NULL;
+    config->baseline_dir = NULL;
+    config->regression_threshold = 0.05;
+    config->num_message_sizes = 0;
+    config->num_process_counts = 0;
+    config->contention_op = NULL;
+    config->interleave_op = NULL;
+    config->num_algorithms = 0;
+
+    // Parse arguments
+    int opt;
+    while ((opt = getopt(argc, argv, "i:w:Wrvp:j:c:d:k:ea:m:s:Cn:O:I:x:tK:P:S:R:B:T:h")) != -1) {
+        switch (opt) {
+            case 'i':
+                config->iterations = atoi(optarg);
+                break;
+            case 'w':
+                config->warmup = atoi(optarg);
+                break;
+            case 'r':
+                config->remove_outliers = 1;
+                break;
+            case 'v':
+                config->verbose = 1;
+                break;
+            case 'p':
+                config->parallel = atoi(optarg);
+                break;
+            case 'j':
+                config->output_json = optarg;
+                break;
+            case 'c':
+                config->output_csv = optarg;
+                break;
+            case 'd':
+                config->sample_dir = optarg;
+                break;
+            case 'k':
+                config->corpus_dir = optarg;
+                break;
+            case 'W':
+                config->adaptive_warmup = 1;
+                break;
+            case 'e':
+                config->perf_counters = 1;
+                break;
+            case 'a':
+                config->adaptive_ci = atof(optarg);
+                break;
+            case 'm':
+                config->max_iterations = atoi(optarg);
+                break;
+            case 's': {
+                char *cursor = optarg;
+                while (*cursor != '\0' &&
+                       config->num_message_sizes < MAX_MESSAGE_SIZES) {
+                    char *end = NULL;
+                    unsigned long long size = strtoull(cursor, &end, 10);
+                    if (end == cursor || size == 0) {
+                        fprintf(stderr, "Invalid message size list: %s\n", optarg);
+                        exit(1);
+                    }
+                    config->message_sizes[config->num_message_sizes++] = (size_t)size;
+                    cursor = (*end == ',') ? end + 1 : end;
+                }
+                break;
+            }
+            case 'C':
+                config->cold_cache = 1;
+                break;
+            case 'n': {
+                char *cursor = optarg;
+                while (*cursor != '\0' &&
+                       config->num_process_counts < MAX_PROCESS_COUNTS) {
+                    char *end = NULL;
+                    long procs = strtol(cursor, &end, 10);
+                    if (end == cursor || procs <= 0) {
+                        fprintf(stderr, "Invalid process count list: %s\n", optarg);
+                        exit(1);
+                    }
+                    config->process_counts[config->num_process_counts++] = (int)procs;
+                    cursor = (*end == ',') ? end + 1 : end;
+                }
+                break;
+            }
+            case 'O':
+                config->contention_op = optarg;
+                break;
+            case 'I':
+                config->interleave_op = optarg;
+                break;
+            case 'x':
+                config->pin_cpu = atoi(optarg);
+                break;
+            case 't':
+                config->telemetry = 1;
+                break;
+            case 'K':
+                config->checkpoint_dir = optarg;
+                break;
+            case 'P':
+                config->provider_name = optarg;
+                break;
+            case 'S':
+                config->stream_path = optarg;
+                break;
+            case 'R':
+                config->store_path = optarg;
+                break;
+            case 'B':
+                config->baseline_dir = optarg;
+                break;
+            case 'T':
+                config->regression_threshold = atof(optarg);
+                break;
+            case 'h':
+                print_usage(argv[0]);
+                exit(0);
+            default:
+                print_usage(argv[0]);
+                exit(1);
+        }
+    }
+
+    // Positional arguments: algorithm names, or "all"
+    for (int i = optind; i < argc; i++) {
+        if (strcmp(argv[i], "all") == 0) {
+            config->num_algorithms = 0;
+            break;
+        }
+        select_algorithm(config, argv[i]);
+    }
+
+    // No selection (or explicit "all"): run everything the adapter supports
+    if (config->num_algorithms == 0) {
+        int count = 0;
+        const char **supported = liboqs_list_algorithms(&count);
+        for (int i = 0; i < count && i < MAX_SELECTED_ALGORITHMS; i++) {
+            config->algorithms[config->num_algorithms++] = supported[i];
+        }
+    }
+}
+
+// ============================================================================
+// Result Consolidation
+// ============================================================================
+
+/**
+ * @brief Print and persist the consolidated result set according to CLI config
+ *
+ * Builds one flat BenchmarkResultSet over all per-algorithm sets (shallow
+ * copies: sample arrays and strings stay owned by the source sets) so the
+ * run emits a single JSON/CSV file with per-row algorithm tags.
+ */
+static int output_consolidated(const cli_config_t *cli_config,
+                               BenchmarkResultSet **sets, int num_sets) {
+    int total = 0;
+    for (int i = 0; i < num_sets; i++) {
+        total += sets[i] ? sets[i]->num_results : 0;
+    }
+    if (total == 0) {
+        LOG_WARN("No results to output");
+        return PQC_ERROR_INVALID_STATE;
+    }
+
+    BenchmarkResult *merged =
+        (BenchmarkResult*)malloc((size_t)total * sizeof(BenchmarkResult));
+    if (!merged) {
+        LOG_ERROR("Failed to allocate consolidated result array");
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    int n = 0;
+    for (int i = 0; i < num_sets; i++) {
+        if (!sets[i]) continue;
+        for (int j = 0; j < sets[i]->num_results; j++) {
+            merged[n++] = sets[i]->results[j];
+        }
+    }
+
+    BenchmarkResultSet consolidated = {
+        .results = merged,
+        .num_results = total,
+        .algorithm = (num_sets == 1 && sets[0]) ? sets[0]->algorithm : "all",
+        .architecture = pqc_benchmark_get_architecture()
+    };
+
+    printf("\n");
+    pqc_benchmark_print_results(&consolidated);
+
+    int ret = 0;
+    if (cli_config->output_json &&
+        pqc_benchmark_write_json(&consolidated, cli_config->output_json) != 0) {
+        ret = -1;
+    }
+    if (cli_config->output_csv &&
+        pqc_benchmark_write_csv(&consolidated, cli_config->output_csv) != 0) {
+        ret = -1;
+    }
+    if (cli_config->sample_dir &&
+        pqc_benchmark_write_samples(&consolidated, cli_config->sample_dir) != 0) {
+        ret = -1;
+    }
+    if (cli_config->store_path) {
+        pqc_results_store_t store;
+        if (pqc_results_store_open(&store, cli_config->store_path) != 0 ||
+            pqc_results_store_append(&store, &consolidated, 0) != 0) {
+            ret = -1;
+        }
+        pqc_results_store_close(&store);
+    }
+
+    free(merged);  // Shallow copies: the source sets still own the payloads
+    return ret;
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char *argv[]) {
+    // Parse command-line arguments
+    cli_config_t cli_config;
+    parse_args(argc, argv, &cli_config);
+
+    // Initialize logger
+    logger_config_t logger_config = {
+        .min_level = cli_config.verbose ? LOG_LEVEL_DEBUG : LOG_LEVEL_INFO,
+        .file_output = NULL,
+        .use_colors = 1,
+        .include_timestamp = 1,
+        .include_source_info = 0
+    };
+    logger_init(logger_config);
+
+    // Async logging keeps I/O off the measurement path; logger_close()
+    // drains the ring on every exit below
+    if (logger_async_start() != 0) {
+        LOG_WARN("Async logger unavailable, falling back to synchronous logging");
+    }
+
+    // Print configuration
+    LOG_INFO("=== PQC Benchmark Configuration ===");
+    LOG_INFO("Algorithms: %d selected", cli_config.num_algorithms);
+    LOG_INFO("Iterations: %d", cli_config.iterations);
+    LOG_INFO("Warmup iterations: %d", cli_config.warmup);
+    LOG_INFO("Remove outliers: %s", cli_config.remove_outliers ? "yes" : "no");
+    LOG_INFO("===================================");
+
+    // Create the selected provider (one init shared by every algorithm);
+    // both providers expose the same algorithm name set
+    PQCProvider *provider = NULL;
+    if (strcmp(cli_config.provider_name, "liboqs") == 0) {
+        provider = create_liboqs_provider();
+        // Direct kernels call liboqs symbols, so they are only valid when
+        // liboqs is the provider backing the algorithm names
+        liboqs_register_direct_loops();
+    } else if (strcmp(cli_config.provider_name, "openssl") == 0) {
+        provider = create_openssl_provider();
+    } else {
+        LOG_ERROR("Unknown provider: %s (expected liboqs or openssl)",
+                  cli_config.provider_name);
+        logger_close();
+        return 1;
+    }
+    if (!provider) {
+        LOG_ERROR("Failed to create %s provider", cli_config.provider_name);
+        logger_close();
+        return 1;
+    }
+    LOG_INFO("Provider: %s %s", provider->name, provider->version);
+
+    void *provider_ctx = provider->init(provider);
+    if (!provider_ctx) {
+        LOG_ERROR("Failed to initialize provider");
+        logger_close();
+        return 1;
+    }
+
+    // Configure benchmark engine
+    BenchmarkConfig bench_config;
+    pqc_benchmark_config_init(&bench_config);
+    bench_config.num_iterations = cli_config.iterations;
+    bench_config.warmup_iterations = cli_config.warmup;
+    bench_config.verbose = cli_config.verbose;
+    bench_config.remove_outliers = cli_config.remove_outliers;
+    bench_config.outlier_threshold = OUTLIER_MULTIPLIER;
+    bench_config.parallel_workers = cli_config.parallel;
+    bench_config.corpus_dir = cli_config.corpus_dir;
+    bench_config.perf_counters = (cli_config.perf_counters != 0);
+    bench_config.cold_cache = (cli_config.cold_cache != 0);
+    bench_config.pin_cpu = cli_config.pin_cpu;
+    bench_config.cpu_telemetry = (cli_config.telemetry != 0);
+    bench_config.adaptive_warmup = (cli_config.adaptive_warmup != 0);
+    bench_config.checkpoint_dir = cli_config.checkpoint_dir;
+    bench_config.baseline_dir = cli_config.baseline_dir;
+    if (cli_config.regression_threshold > 0.0) {
+        bench_config.regression_threshold = cli_config.regression_threshold;
+    }
+    if (cli_config.adaptive_ci > 0.0) {
+        bench_config.adaptive_sampling = true;
+        bench_config.ci_target = cli_config.adaptive_ci;
+        if (cli_config.max_iterations > 0) {
+            bench_config.max_iterations = cli_config.max_iterations;
+        }
+    }
+    if (cli_config.num_message_sizes > 0) {
+        bench_config.message_sizes = cli_config.message_sizes;
+        bench_config.num_message_sizes = cli_config.num_message_sizes;
+    }
+
+    // Open the incremental record stream before anything runs, so results
+    // become visible operation by operation instead of at campaign end
+    pqc_result_stream_t result_stream;
+    if (cli_config.stream_path != NULL) {
+        size_t path_len = strlen(cli_config.stream_path);
+        pqc_result_stream_format_t fmt =
+            (path_len > 4 &&
+             strcmp(cli_config.stream_path + path_len - 4, ".csv") == 0)
+                ? PQC_STREAM_FORMAT_CSV
+                : PQC_STREAM_FORMAT_JSONL;
+        if (pqc_result_stream_open(&result_stream, cli_config.stream_path,
+                                   fmt, false) != 0) {
+            LOG_ERROR("Failed to open result stream: %s",
+                      cli_config.stream_path);
+            provider->cleanup(provider, provider_ctx);
+            logger_close();
+            return 1;
+        }
+        bench_config.result_stream = &result_stream;
+    }
+
+    // Create all selected algorithm handles up front
+    const PQCAlgorithm *algs[MAX_SELECTED_ALGORITHMS];
+    int num_created = 0;
+    int failed = 0;
+
+    for (int i = 0; i < cli_config.num_algorithms; i++) {
+        PQCAlgorithm *alg = provider->create_algorithm(provider, provider_ctx,
+                                                       cli_config.algorithms[i]);
+        if (!alg) {
+            LOG_ERROR("Failed to create algorithm: %s", cli_config.algorithms[i]);
+            failed++;
+            continue;
+        }
+        algs[num_created++] = alg;
+    }
+
+    // Run the campaign: one result set per algorithm, consolidated at the
+    // end (interleaved mode produces a single combined set instead)
+    BenchmarkResultSet **result_sets = NULL;
+    int num_result_sets = num_created;
+    int campaign_failed = 0;
+
+    if (cli_config.interleave_op != NULL) {
+        // Interleaved A/B: all selected algorithms share one loop
+        if (num_created < 2) {
+            LOG_ERROR("Interleaved mode needs at least 2 algorithms");
+            campaign_failed = 1;
+        } else {
+            result_sets = (BenchmarkResultSet**)calloc(
+                1, sizeof(BenchmarkResultSet*));
+            if (!result_sets) {
+                LOG_ERROR("Failed to allocate result set array");
+                campaign_failed = 1;
+            } else {
+                num_result_sets = 1;
+                int ret = pqc_benchmark_interleaved(algs, num_created,
+                                                    cli_config.interleave_op,
+                                                    &bench_config,
+                                                    &result_sets[0]);
+                if (ret != 0 || !result_sets[0]) {
+                    LOG_ERROR("Interleaved benchmark failed");
+                    result_sets[0] = NULL;
+                    campaign_failed = 1;
+                }
+            }
+        }
+    } else if (cli_config.num_process_counts > 0) {
+        // Contention sweep: one result per (algorithm, process count)
+        result_sets = (BenchmarkResultSet**)calloc(
+            (size_t)(num_created > 0 ? num_created : 1),
+            sizeof(BenchmarkResultSet*));
+        if (!result_sets) {
+            LOG_ERROR("Failed to allocate result set array");
+            campaign_failed = 1;
+        }
+
+        for (int i = 0; result_sets && i < num_created; i++) {
+            const char *op = cli_config.contention_op;
+            if (!op) {
+                op = (algs[i]->type == PQC_ALG_TYPE_SIGNATURE) ? "sign"
+                                                               : "decaps";
+            }
+
+            int ret = pqc_benchmark_contention(algs[i], op, &bench_config,
+                                               cli_config.process_counts,
+                                               cli_config.num_process_counts,
+                                               &result_sets[i]);
+            if (ret != 0 || !result_sets[i]) {
+                LOG_ERROR("Contention sweep failed for %s/%s",
+                          algs[i]->name, op);
+                result_sets[i] = NULL;
+                failed++;
+            }
+        }
+    } else if (cli_config.parallel > 1) {
+        LOG_INFO("Running in parallel mode with %d workers", cli_config.parallel);
+
+        int ret = 0;
+        if (num_created > 0) {
+            ret = pqc_benchmark_algorithms_parallel(algs, num_created,
+                                                    &bench_config, &result_sets);
+        }
+        if (ret != 0 || !result_sets) {
+            LOG_ERROR("Parallel benchmark campaign failed");
+            campaign_failed = 1;
+            result_sets = NULL;
+        }
+    } else {
+        result_sets = (BenchmarkResultSet**)calloc((size_t)(num_created > 0 ? num_created : 1),
+                                                   sizeof(BenchmarkResultSet*));
+        if (!result_sets) {
+            LOG_ERROR("Failed to allocate result set array");
+            campaign_failed = 1;
+        }
+
+        for (int i = 0; result_sets && i < num_created; i++) {
+            LOG_INFO("===========================================");
+            LOG_INFO("Starting benchmark: %s", algs[i]->name);
+            LOG_INFO("===========================================");
+
+            int ret = pqc_benchmark_algorithm(algs[i], &bench_config,
+                                              &result_sets[i]);
+            if (ret != 0 || !result_sets[i]) {
+                LOG_ERROR("Benchmark failed for %s", algs[i]->name);
+                result_sets[i] = NULL;
+                failed++;
+            }
+        }
+    }
+
+    if (bench_config.result_stream != NULL) {
+        if (pqc_result_stream_close(bench_config.result_stream) != 0) {
+            LOG_ERROR("Result stream reported write errors");
+            failed++;
+        }
+    }
+
+    // Emit one consolidated output over everything that ran
+    int regressions = 0;
+    if (result_sets) {
+        if (output_consolidated(&cli_config, result_sets, num_result_sets) != 0) {
+            failed++;
+        }
+        for (int i = 0; i < num_result_sets; i++) {
+            if (result_sets[i]) {
+                int reg = pqc_benchmark_result_set_regressions(result_sets[i]);
+                if (reg > 0) {
+                    regressions += reg;
+                }
+            }
+            pqc_benchmark_result_set_free(result_sets[i]);
+        }
+        free(result_sets);
+    }
+
+    // Cleanup
+    for (int i = 0; i < num_created; i++) {
+        provider->destroy_algorithm(provider, provider_ctx,
+                                    (PQCAlgorithm*)algs[i]);
+    }
+    provider->cleanup(provider, provider_ctx);
+
+    printf("\n");
+    if (failed == 0 && !campaign_failed) {
+        LOG_INFO("All benchmarks completed successfully");
+    } else {
+        LOG_ERROR("%d/%d benchmarks failed", campaign_failed ? num_created : failed,
+                  cli_config.num_algorithms);
+    }
+
+    // Regression gate: distinct exit code so CI can tell "benchmark broke"
+    // from "benchmark ran fine but got slower"
+    if (regressions > 0) {
+        LOG_ERROR("%d operation(s) regressed beyond %.0f%% of baseline",
+                  regressions, bench_config.regression_threshold * 100.0);
+        logger_close();
+        return 2;
+    }
+
+    logger_close();
+    return (failed == 0 && !campaign_failed) ? 0 : 1;
+}
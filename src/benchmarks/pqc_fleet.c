@@ -0,0 +1,879 @@
+/**
+ * @file pqc_fleet.c
+ * @brief Distributed campaign orchestrator with work-stealing scheduling
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Replaces the serial run-remote-* flow, where every board runs the whole
+ * campaign alone, with dynamic scheduling across the fleet:
+ *
+ * - Controller mode (-H): decomposes a campaign into (algorithm, operation)
+ *   work units, connects to every agent, and hands each agent one unit at a
+ *   time. Idle agents pull the next pending unit from the shared queue, so
+ *   fast boards steal work that would otherwise wait behind slow ones, and
+ *   the campaign finishes in roughly the time of the slowest single unit.
+ *   Returned records are merged into one consolidated result set.
+ *
+ * - Agent mode (-l): listens on a TCP port, instantiates the requested
+ *   algorithm through the liboqs adapter, runs the unit with the benchmark
+ *   engine and streams the summary record back.
+ *
+ * Wire protocol: fixed-layout structs behind a magic/version/length header.
+ * Scalar layout is host-order; the fleet (x86_64 controller, arm64 and
+ * riscv64 boards) is uniformly little-endian, which the HELLO handshake
+ * verifies with a byte-order probe before any unit is dispatched.
+ *
+ * A unit lost to a dropped connection is requeued and picked up by another
+ * agent; a unit the agent itself reports as failed is counted and not
+ * retried, since a deterministic failure would just fail everywhere.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <getopt.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/utsname.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+
+#include "generic_benchmark.h"
+#include "../adapters/liboqs_adapter.h"
+#include "../adapters/liboqs_direct.h"
+#include "../core/error_codes.h"
+#include "../utils/logger.h"
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+#define DEFAULT_ITERATIONS 1000
+#define DEFAULT_WARMUP_ITERATIONS 100
+#define DEFAULT_AGENT_PORT 7455
+
+#define MAX_AGENTS 32
+#define MAX_UNITS 256
+#define MAX_SELECTED_ALGORITHMS 16
+
+// ============================================================================
+// Wire Protocol
+// ============================================================================
+
+#define PQC_FLEET_MAGIC 0x50514346u  // "FCQP" on a little-endian wire
+#define PQC_FLEET_VERSION 1
+
+typedef enum {
+    PQC_FLEET_MSG_HELLO = 1,     ///< Agent -> controller on connect
+    PQC_FLEET_MSG_UNIT = 2,      ///< Controller -> agent: run this unit
+    PQC_FLEET_MSG_RESULT = 3,    ///< Agent -> controller: unit summary record
+    PQC_FLEET_MSG_FAIL = 4,      ///< Agent -> controller: unit failed
+    PQC_FLEET_MSG_DONE = 5       ///< Controller -> agent: queue drained
+} pqc_fleet_msg_type_t;
+
+/**
+ * @brief Frame header preceding every message
+ */
+typedef struct {
+    uint32_t magic;                ///< PQC_FLEET_MAGIC
+    uint16_t version;              ///< PQC_FLEET_VERSION
+    uint16_t type;                 ///< pqc_fleet_msg_type_t
+    uint32_t payload_len;          ///< Bytes following the header
+} pqc_fleet_header_t;
+
+/**
+ * @brief Agent greeting: identity plus a byte-order probe
+ */
+typedef struct {
+    uint32_t order_probe;          ///< Must read back as PQC_FLEET_MAGIC
+    char architecture[32];         ///< uname machine string of the agent
+} pqc_fleet_hello_t;
+
+/**
+ * @brief One schedulable work unit
+ */
+typedef struct {
+    char algorithm[32];            ///< Algorithm name (e.g., "mldsa87")
+    char operation[16];            ///< Operation name (e.g., "sign")
+    int32_t iterations;            ///< Measurement iterations
+    int32_t warmup;                ///< Warmup iterations (fixed mode)
+    uint8_t adaptive_warmup;       ///< Converge warmup instead of fixed count
+    uint8_t cold_cache;            ///< Evict the working set before samples
+    uint8_t reserved[2];           ///< Padding, must be zero
+} pqc_fleet_unit_t;
+
+/**
+ * @brief Summary record returned for a completed unit
+ *
+ * Carries the scalar statistics only; raw samples stay on the agent.
+ */
+typedef struct {
+    char algorithm[32];            ///< Algorithm the unit ran
+    char operation[16];            ///< Operation the unit ran
+    char architecture[32];         ///< Agent architecture (uname machine)
+    char provider[16];             ///< Providing library
+    int32_t num_samples;           ///< Samples taken
+    int32_t batch_size;            ///< Operations per timed batch
+    int32_t warmup_used;           ///< Warmup iterations before recording
+    int32_t warmup_converged;      ///< Adaptive warmup stabilized
+    double mean_us;                ///< Mean in microseconds
+    double median_us;              ///< Median in microseconds
+    double stddev_us;              ///< Standard deviation in microseconds
+    double min_us;                 ///< Minimum in microseconds
+    double max_us;                 ///< Maximum in microseconds
+    double p95_us;                 ///< 95th percentile in microseconds
+    double p99_us;                 ///< 99th percentile in microseconds
+    double p999_us;                ///< 99.9th percentile in microseconds
+    double p9999_us;               ///< 99.99th percentile in microseconds
+    double throughput_ops_sec;     ///< Sustained operations per second
+    double ns_per_op;              ///< Amortized nanoseconds per operation
+} pqc_fleet_record_t;
+
+// ============================================================================
+// Socket Helpers
+// ============================================================================
+
+static int send_all(int fd, const void *buf, size_t len) {
+    const uint8_t *p = (const uint8_t *)buf;
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            return PQC_ERROR_IO;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return PQC_SUCCESS;
+}
+
+static int recv_all(int fd, void *buf, size_t len) {
+    uint8_t *p = (uint8_t *)buf;
+    while (len > 0) {
+        ssize_t n = recv(fd, p, len, 0);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            return PQC_ERROR_IO;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return PQC_SUCCESS;
+}
+
+static int send_message(int fd, uint16_t type, const void *payload,
+                        uint32_t payload_len) {
+    pqc_fleet_header_t header = {
+        .magic = PQC_FLEET_MAGIC,
+        .version = PQC_FLEET_VERSION,
+        .type = type,
+        .payload_len = payload_len
+    };
+    if (send_all(fd, &header, sizeof(header)) != PQC_SUCCESS) {
+        return PQC_ERROR_IO;
+    }
+    if (payload_len > 0 &&
+        send_all(fd, payload, payload_len) != PQC_SUCCESS) {
+        return PQC_ERROR_IO;
+    }
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Receive one message whose payload fits in a caller buffer
+ * @return Message type, or negative error code
+ */
+static int recv_message(int fd, void *payload, uint32_t payload_cap,
+                        uint32_t *payload_len) {
+    pqc_fleet_header_t header;
+    if (recv_all(fd, &header, sizeof(header)) != PQC_SUCCESS) {
+        return PQC_ERROR_IO;
+    }
+    if (header.magic != PQC_FLEET_MAGIC ||
+        header.version != PQC_FLEET_VERSION) {
+        LOG_ERROR("Bad frame header (magic 0x%08x, version %u)",
+                  header.magic, header.version);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+    if (header.payload_len > payload_cap) {
+        LOG_ERROR("Frame payload %u exceeds buffer %u",
+                  header.payload_len, payload_cap);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+    if (header.payload_len > 0 &&
+        recv_all(fd, payload, header.payload_len) != PQC_SUCCESS) {
+        return PQC_ERROR_IO;
+    }
+    if (payload_len != NULL) {
+        *payload_len = header.payload_len;
+    }
+    return (int)header.type;
+}
+
+// ============================================================================
+// Agent
+// ============================================================================
+
+static volatile sig_atomic_t agent_running = 1;
+
+static void agent_signal_handler(int sig) {
+    (void)sig;
+    agent_running = 0;
+}
+
+/**
+ * @brief Execute one work unit and fill its summary record
+ */
+static int agent_run_unit(const pqc_fleet_unit_t *unit,
+                          const char *architecture,
+                          pqc_fleet_record_t *record) {
+    PQCAlgorithm *alg = liboqs_create_kem_algorithm(unit->algorithm);
+    if (alg == NULL) {
+        alg = liboqs_create_sig_algorithm(unit->algorithm);
+    }
+    if (alg == NULL) {
+        LOG_ERROR("Agent cannot instantiate algorithm %s", unit->algorithm);
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    BenchmarkConfig config;
+    pqc_benchmark_config_init(&config);
+    config.num_iterations = unit->iterations;
+    config.warmup_iterations = unit->warmup;
+    config.adaptive_warmup = (unit->adaptive_warmup != 0);
+    config.cold_cache = (unit->cold_cache != 0);
+
+    BenchmarkResult *result = NULL;
+    int ret = pqc_benchmark_operation(alg, unit->operation, &config, &result);
+    liboqs_destroy_algorithm(alg);
+    if (ret != PQC_SUCCESS || result == NULL) {
+        return ret != PQC_SUCCESS ? ret : PQC_ERROR_OPERATION_FAILED;
+    }
+
+    memset(record, 0, sizeof(*record));
+    snprintf(record->algorithm, sizeof(record->algorithm), "%s",
+             unit->algorithm);
+    snprintf(record->operation, sizeof(record->operation), "%s",
+             unit->operation);
+    snprintf(record->architecture, sizeof(record->architecture), "%.*s",
+             (int)sizeof(record->architecture) - 1, architecture);
+    snprintf(record->provider, sizeof(record->provider), "%s",
+             result->provider != NULL ? result->provider : "");
+    record->num_samples = result->num_samples;
+    record->batch_size = result->batch_size;
+    record->warmup_used = result->warmup_iterations_used;
+    record->warmup_converged = result->warmup_converged ? 1 : 0;
+    record->mean_us = result->mean;
+    record->median_us = result->median;
+    record->stddev_us = result->std_dev;
+    record->min_us = result->min;
+    record->max_us = result->max;
+    record->p95_us = result->p95;
+    record->p99_us = result->p99;
+    record->p999_us = result->p999;
+    record->p9999_us = result->p9999;
+    record->throughput_ops_sec = result->throughput_ops_sec;
+    record->ns_per_op = result->amortized_ns_op;
+
+    pqc_benchmark_result_free(result);
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Serve one controller session on an accepted connection
+ */
+static void agent_serve_session(int fd, const char *architecture) {
+    pqc_fleet_hello_t hello;
+    memset(&hello, 0, sizeof(hello));
+    hello.order_probe = PQC_FLEET_MAGIC;
+    snprintf(hello.architecture, sizeof(hello.architecture), "%.*s",
+             (int)sizeof(hello.architecture) - 1, architecture);
+    if (send_message(fd, PQC_FLEET_MSG_HELLO, &hello,
+                     sizeof(hello)) != PQC_SUCCESS) {
+        LOG_WARN("Failed to greet controller");
+        return;
+    }
+
+    for (;;) {
+        pqc_fleet_unit_t unit;
+        uint32_t len = 0;
+        int type = recv_message(fd, &unit, sizeof(unit), &len);
+        if (type == PQC_FLEET_MSG_DONE) {
+            LOG_INFO("Controller drained the queue, session complete");
+            return;
+        }
+        if (type != PQC_FLEET_MSG_UNIT || len != sizeof(unit)) {
+            if (type < 0) {
+                LOG_WARN("Controller connection lost");
+            } else {
+                LOG_WARN("Unexpected message type %d", type);
+            }
+            return;
+        }
+        unit.algorithm[sizeof(unit.algorithm) - 1] = '\0';
+        unit.operation[sizeof(unit.operation) - 1] = '\0';
+
+        LOG_INFO("Running unit %s/%s (%d iterations)",
+                 unit.algorithm, unit.operation, unit.iterations);
+        pqc_fleet_record_t record;
+        int ret = agent_run_unit(&unit, architecture, &record);
+        if (ret == PQC_SUCCESS) {
+            if (send_message(fd, PQC_FLEET_MSG_RESULT, &record,
+                             sizeof(record)) != PQC_SUCCESS) {
+                LOG_WARN("Failed to return result for %s/%s",
+                         unit.algorithm, unit.operation);
+                return;
+            }
+        } else {
+            int32_t code = ret;
+            if (send_message(fd, PQC_FLEET_MSG_FAIL, &code,
+                             sizeof(code)) != PQC_SUCCESS) {
+                return;
+            }
+        }
+    }
+}
+
+static int run_agent(int port) {
+    signal(SIGINT, agent_signal_handler);
+    signal(SIGTERM, agent_signal_handler);
+
+    // Agents measure through liboqs, so the direct kernels always apply
+    liboqs_register_direct_loops();
+
+    struct utsname uts;
+    const char *architecture = "unknown";
+    if (uname(&uts) == 0) {
+        architecture = uts.machine;
+    }
+
+    int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        LOG_ERROR("Failed to create listening socket: %s", strerror(errno));
+        return 1;
+    }
+    int one = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)port);
+    if (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        listen(listen_fd, 4) < 0) {
+        LOG_ERROR("Failed to bind port %d: %s", port, strerror(errno));
+        close(listen_fd);
+        return 1;
+    }
+
+    LOG_INFO("Fleet agent (%s) listening on port %d", architecture, port);
+    while (agent_running) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG_ERROR("accept failed: %s", strerror(errno));
+            break;
+        }
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        agent_serve_session(fd, architecture);
+        close(fd);
+    }
+
+    close(listen_fd);
+    LOG_INFO("Fleet agent shutting down");
+    return 0;
+}
+
+// ============================================================================
+// Controller
+// ============================================================================
+
+/**
+ * @brief Shared campaign state the per-agent threads pull from
+ *
+ * The pending queue doubles as the work-stealing pool: whichever agent
+ * thread locks the mutex first takes the next unit, and units lost to a
+ * dropped connection are pushed back for the surviving agents.
+ */
+typedef struct {
+    pqc_fleet_unit_t units[MAX_UNITS];     ///< Unit queue (FIFO)
+    int num_units;                         ///< Units enqueued in total
+    int next;                              ///< Next unit to hand out
+    pqc_fleet_record_t records[MAX_UNITS]; ///< Completed unit records
+    int num_records;                       ///< Completed units
+    int num_failed;                        ///< Units that failed on an agent
+    pthread_mutex_t lock;                  ///< Guards all of the above
+} fleet_queue_t;
+
+typedef struct {
+    const char *endpoint;          ///< host:port string from the CLI
+    fleet_queue_t *queue;          ///< Shared campaign state
+    int units_done;                ///< Units this agent completed
+    char architecture[32];         ///< Reported by the agent's HELLO
+} agent_thread_args_t;
+
+static int queue_take(fleet_queue_t *queue, pqc_fleet_unit_t *unit) {
+    pthread_mutex_lock(&queue->lock);
+    int available = queue->next < queue->num_units;
+    if (available) {
+        *unit = queue->units[queue->next++];
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return available;
+}
+
+static void queue_requeue(fleet_queue_t *queue, const pqc_fleet_unit_t *unit) {
+    pthread_mutex_lock(&queue->lock);
+    if (queue->num_units < MAX_UNITS) {
+        queue->units[queue->num_units++] = *unit;
+    }
+    pthread_mutex_unlock(&queue->lock);
+}
+
+static void queue_record(fleet_queue_t *queue,
+                         const pqc_fleet_record_t *record) {
+    pthread_mutex_lock(&queue->lock);
+    if (queue->num_records < MAX_UNITS) {
+        queue->records[queue->num_records++] = *record;
+    }
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/**
+ * @brief Connect to one agent endpoint ("host:port", port optional)
+ */
+static int connect_to_agent(const char *endpoint) {
+    char host[128];
+    const char *port = NULL;
+    const char *colon = strrchr(endpoint, ':');
+    if (colon != NULL) {
+        size_t host_len = (size_t)(colon - endpoint);
+        if (host_len >= sizeof(host)) {
+            return -1;
+        }
+        memcpy(host, endpoint, host_len);
+        host[host_len] = '\0';
+        port = colon + 1;
+    } else {
+        snprintf(host, sizeof(host), "%s", endpoint);
+    }
+    char default_port[8];
+    if (port == NULL) {
+        snprintf(default_port, sizeof(default_port), "%d",
+                 DEFAULT_AGENT_PORT);
+        port = default_port;
+    }
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    struct addrinfo *res = NULL;
+    if (getaddrinfo(host, port, &hints, &res) != 0) {
+        LOG_ERROR("Cannot resolve agent %s", endpoint);
+        return -1;
+    }
+
+    int fd = -1;
+    for (struct addrinfo *ai = res; ai != NULL; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+            break;
+        }
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+
+    if (fd >= 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+/**
+ * @brief One controller thread driving one agent
+ *
+ * Pulls units until the queue drains or the connection drops; an in-flight
+ * unit on a dropped connection goes back to the queue for other agents.
+ */
+static void *agent_thread_main(void *p) {
+    agent_thread_args_t *args = (agent_thread_args_t *)p;
+
+    int fd = connect_to_agent(args->endpoint);
+    if (fd < 0) {
+        LOG_WARN("Agent %s unreachable, its share will be redistributed",
+                 args->endpoint);
+        return NULL;
+    }
+
+    pqc_fleet_hello_t hello;
+    uint32_t len = 0;
+    int type = recv_message(fd, &hello, sizeof(hello), &len);
+    if (type != PQC_FLEET_MSG_HELLO || len != sizeof(hello) ||
+        hello.order_probe != PQC_FLEET_MAGIC) {
+        LOG_ERROR("Agent %s failed the handshake (type %d); is it running "
+                  "a matching build on a little-endian machine?",
+                  args->endpoint, type);
+        close(fd);
+        return NULL;
+    }
+    hello.architecture[sizeof(hello.architecture) - 1] = '\0';
+    snprintf(args->architecture, sizeof(args->architecture), "%s",
+             hello.architecture);
+    LOG_INFO("Agent %s online (%s)", args->endpoint, hello.architecture);
+
+    pqc_fleet_unit_t unit;
+    while (queue_take(args->queue, &unit)) {
+        if (send_message(fd, PQC_FLEET_MSG_UNIT, &unit,
+                         sizeof(unit)) != PQC_SUCCESS) {
+            LOG_WARN("Agent %s dropped, requeueing %s/%s",
+                     args->endpoint, unit.algorithm, unit.operation);
+            queue_requeue(args->queue, &unit);
+            close(fd);
+            return NULL;
+        }
+
+        union {
+            pqc_fleet_record_t record;
+            int32_t code;
+        } reply;
+        type = recv_message(fd, &reply, sizeof(reply), &len);
+        if (type == PQC_FLEET_MSG_RESULT && len == sizeof(reply.record)) {
+            queue_record(args->queue, &reply.record);
+            args->units_done++;
+            LOG_INFO("Agent %s finished %s/%s (median %.2f µs)",
+                     args->endpoint, unit.algorithm, unit.operation,
+                     reply.record.median_us);
+        } else if (type == PQC_FLEET_MSG_FAIL && len == sizeof(reply.code)) {
+            LOG_ERROR("Agent %s failed %s/%s (code %d), not retrying",
+                      args->endpoint, unit.algorithm, unit.operation,
+                      reply.code);
+            pthread_mutex_lock(&args->queue->lock);
+            args->queue->num_failed++;
+            pthread_mutex_unlock(&args->queue->lock);
+        } else {
+            LOG_WARN("Agent %s dropped mid-unit, requeueing %s/%s",
+                     args->endpoint, unit.algorithm, unit.operation);
+            queue_requeue(args->queue, &unit);
+            close(fd);
+            return NULL;
+        }
+    }
+
+    send_message(fd, PQC_FLEET_MSG_DONE, NULL, 0);
+    close(fd);
+    return NULL;
+}
+
+/**
+ * @brief Merge completed records into one owned BenchmarkResultSet
+ *
+ * Only the scalar statistics travel over the wire, so the merged results
+ * carry no sample arrays; the set-level JSON/CSV writers handle that the
+ * same way they handle streaming-mode results.
+ */
+static BenchmarkResultSet *merge_records(const fleet_queue_t *queue) {
+    BenchmarkResultSet *set =
+        (BenchmarkResultSet *)calloc(1, sizeof(BenchmarkResultSet));
+    if (set == NULL) {
+        return NULL;
+    }
+    set->algorithm = strdup("fleet");
+    set->architecture = strdup("mixed");
+    set->results = (BenchmarkResult *)calloc((size_t)queue->num_records,
+                                             sizeof(BenchmarkResult));
+    if (set->algorithm == NULL || set->architecture == NULL ||
+        set->results == NULL) {
+        pqc_benchmark_result_set_free(set);
+        return NULL;
+    }
+
+    for (int i = 0; i < queue->num_records; i++) {
+        const pqc_fleet_record_t *rec = &queue->records[i];
+        BenchmarkResult *r = &set->results[i];
+        r->algorithm = strdup(rec->algorithm);
+        r->operation = strdup(rec->operation);
+        r->architecture = strdup(rec->architecture);
+        if (r->algorithm == NULL || r->operation == NULL ||
+            r->architecture == NULL) {
+            set->num_results = i + 1;
+            pqc_benchmark_result_set_free(set);
+            return NULL;
+        }
+        r->num_samples = rec->num_samples;
+        r->batch_size = rec->batch_size;
+        r->warmup_iterations_used = rec->warmup_used;
+        r->warmup_converged = (rec->warmup_converged != 0);
+        r->mean = rec->mean_us;
+        r->median = rec->median_us;
+        r->std_dev = rec->stddev_us;
+        r->min = rec->min_us;
+        r->max = rec->max_us;
+        r->p95 = rec->p95_us;
+        r->p99 = rec->p99_us;
+        r->p999 = rec->p999_us;
+        r->p9999 = rec->p9999_us;
+        r->throughput_ops_sec = rec->throughput_ops_sec;
+        r->amortized_ns_op = rec->ns_per_op;
+        set->num_results = i + 1;
+    }
+    return set;
+}
+
+typedef struct {
+    const char *agents[MAX_AGENTS];
+    int num_agents;
+    const char *algorithms[MAX_SELECTED_ALGORITHMS];
+    int num_algorithms;
+    int iterations;
+    int warmup;
+    int adaptive_warmup;
+    int cold_cache;
+    const char *output_json;
+    const char *output_csv;
+} controller_config_t;
+
+/**
+ * @brief Build the unit queue: every (algorithm, operation) pair
+ */
+static void build_units(const controller_config_t *config,
+                        fleet_queue_t *queue) {
+    static const char *KEM_OPS[] = { "keygen", "encaps", "decaps",
+                                     "handshake" };
+    static const char *SIG_OPS[] = { "keygen", "sign", "verify",
+                                     "verify_batch" };
+
+    for (int i = 0; i < config->num_algorithms; i++) {
+        const char *name = config->algorithms[i];
+        int is_kem = (strncmp(name, "mlkem", 5) == 0);
+        const char **ops = is_kem ? KEM_OPS : SIG_OPS;
+        int num_ops = is_kem ? (int)(sizeof(KEM_OPS) / sizeof(KEM_OPS[0]))
+                             : (int)(sizeof(SIG_OPS) / sizeof(SIG_OPS[0]));
+
+        for (int k = 0; k < num_ops && queue->num_units < MAX_UNITS; k++) {
+            pqc_fleet_unit_t *unit = &queue->units[queue->num_units++];
+            memset(unit, 0, sizeof(*unit));
+            snprintf(unit->algorithm, sizeof(unit->algorithm), "%s", name);
+            snprintf(unit->operation, sizeof(unit->operation), "%s", ops[k]);
+            unit->iterations = config->iterations;
+            unit->warmup = config->warmup;
+            unit->adaptive_warmup = (uint8_t)config->adaptive_warmup;
+            unit->cold_cache = (uint8_t)config->cold_cache;
+        }
+    }
+}
+
+static int run_controller(const controller_config_t *config) {
+    fleet_queue_t queue;
+    memset(&queue, 0, sizeof(queue));
+    pthread_mutex_init(&queue.lock, NULL);
+    build_units(config, &queue);
+
+    int total_units = queue.num_units;
+    LOG_INFO("Campaign: %d units across %d agents",
+             total_units, config->num_agents);
+
+    agent_thread_args_t args[MAX_AGENTS];
+    pthread_t threads[MAX_AGENTS];
+    int spawned[MAX_AGENTS] = { 0 };
+    memset(args, 0, sizeof(args));
+    for (int i = 0; i < config->num_agents; i++) {
+        args[i].endpoint = config->agents[i];
+        args[i].queue = &queue;
+        spawned[i] = (pthread_create(&threads[i], NULL, agent_thread_main,
+                                     &args[i]) == 0);
+        if (!spawned[i]) {
+            LOG_ERROR("Failed to spawn thread for agent %s",
+                      config->agents[i]);
+        }
+    }
+    for (int i = 0; i < config->num_agents; i++) {
+        if (spawned[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    printf("\nFleet summary: %d/%d units completed, %d failed, "
+           "%d unassigned\n",
+           queue.num_records, total_units, queue.num_failed,
+           queue.num_units - queue.next);
+    for (int i = 0; i < config->num_agents; i++) {
+        printf("  %-24s %-10s %d units\n", config->agents[i],
+               args[i].architecture[0] ? args[i].architecture : "offline",
+               args[i].units_done);
+    }
+
+    int exit_code = 0;
+    if (queue.num_records > 0) {
+        BenchmarkResultSet *merged = merge_records(&queue);
+        if (merged != NULL) {
+            pqc_benchmark_print_results(merged);
+            if (config->output_json != NULL &&
+                pqc_benchmark_write_json(merged,
+                                         config->output_json) != PQC_SUCCESS) {
+                exit_code = 1;
+            }
+            if (config->output_csv != NULL &&
+                pqc_benchmark_write_csv(merged,
+                                        config->output_csv) != PQC_SUCCESS) {
+                exit_code = 1;
+            }
+            pqc_benchmark_result_set_free(merged);
+        } else {
+            exit_code = 1;
+        }
+    }
+    if (queue.num_records < total_units) {
+        exit_code = 1;
+    }
+
+    pthread_mutex_destroy(&queue.lock);
+    return exit_code;
+}
+
+// ============================================================================
+// Command-line Interface
+// ============================================================================
+
+static void print_usage(const char *prog) {
+    printf("Usage: %s -l <port>                 (agent mode)\n", prog);
+    printf("       %s -H <host:port,...> [...]  (controller mode)\n", prog);
+    printf("\nAgent options:\n");
+    printf("  -l <port>   Listen for a controller on <port> "
+           "(default: %d)\n", DEFAULT_AGENT_PORT);
+    printf("\nController options:\n");
+    printf("  -H <list>   Comma-separated agent endpoints (host:port)\n");
+    printf("  -i <num>    Iterations per unit (default: %d)\n",
+           DEFAULT_ITERATIONS);
+    printf("  -w <num>    Warmup iterations per unit (default: %d)\n",
+           DEFAULT_WARMUP_ITERATIONS);
+    printf("  -W          Adaptive warmup on the agents\n");
+    printf("  -C          Cold-cache mode on the agents\n");
+    printf("  -j <file>   Save consolidated results to JSON file\n");
+    printf("  -c <file>   Save consolidated results to CSV file\n");
+    printf("  -v          Verbose output\n");
+    printf("  -h          Show this help message\n");
+    printf("\nAlgorithms are given as positional arguments "
+           "(default: all supported):\n");
+    printf("  %s -H board1:7455,board2:7455 mldsa87 mlkem1024\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    int agent_port = 0;
+    int verbose = 0;
+    controller_config_t config;
+    memset(&config, 0, sizeof(config));
+    config.iterations = DEFAULT_ITERATIONS;
+    config.warmup = DEFAULT_WARMUP_ITERATIONS;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "l:H:i:w:WCj:c:vh")) != -1) {
+        switch (opt) {
+            case 'l':
+                agent_port = atoi(optarg);
+                break;
+            case 'H': {
+                char *cursor = optarg;
+                while (cursor != NULL && *cursor != '\0' &&
+                       config.num_agents < MAX_AGENTS) {
+                    char *comma = strchr(cursor, ',');
+                    if (comma != NULL) {
+                        *comma = '\0';
+                    }
+                    config.agents[config.num_agents++] = cursor;
+                    cursor = (comma != NULL) ? comma + 1 : NULL;
+                }
+                break;
+            }
+            case 'i':
+                config.iterations = atoi(optarg);
+                break;
+            case 'w':
+                config.warmup = atoi(optarg);
+                break;
+            case 'W':
+                config.adaptive_warmup = 1;
+                break;
+            case 'C':
+                config.cold_cache = 1;
+                break;
+            case 'j':
+                config.output_json = optarg;
+                break;
+            case 'c':
+                config.output_csv = optarg;
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case 'h':
+                print_usage(argv[0]);
+                return 0;
+            default:
+                print_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    logger_config_t log_config = {
+        .min_level = verbose ? LOG_LEVEL_DEBUG : LOG_LEVEL_INFO,
+        .file_output = NULL,
+        .use_colors = 1,
+        .include_timestamp = 1,
+        .include_source_info = 0
+    };
+    logger_init(log_config);
+
+    if (agent_port > 0 && config.num_agents > 0) {
+        fprintf(stderr, "Choose either agent mode (-l) or controller "
+                        "mode (-H), not both\n");
+        return 1;
+    }
+
+    if (agent_port > 0) {
+        return run_agent(agent_port);
+    }
+
+    if (config.num_agents == 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // Positional arguments select algorithms, mirroring pqc_bench
+    for (int i = optind; i < argc; i++) {
+        if (!liboqs_supports_algorithm(argv[i])) {
+            fprintf(stderr, "Unknown algorithm: %s\n", argv[i]);
+            return 1;
+        }
+        if (config.num_algorithms < MAX_SELECTED_ALGORITHMS) {
+            config.algorithms[config.num_algorithms++] = argv[i];
+        }
+    }
+    if (config.num_algorithms == 0) {
+        int count = 0;
+        const char **supported = liboqs_list_algorithms(&count);
+        for (int i = 0; i < count && i < MAX_SELECTED_ALGORITHMS; i++) {
+            config.algorithms[config.num_algorithms++] = supported[i];
+        }
+    }
+
+    return run_controller(&config);
+}
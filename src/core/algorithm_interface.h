@@ -118,6 +118,7 @@ struct PQCAlgorithm {
     // Metadata
     const char *name;              ///< Algorithm name (e.g., "mlkem512")
     const char *variant;           ///< Variant identifier (e.g., "512")
+    const char *provider;          ///< Providing library (e.g., "liboqs"; optional)
     pqc_algorithm_type_t type;     ///< Algorithm type (KEM or Signature)
     
     // Function pointers for operations
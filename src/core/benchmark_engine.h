@@ -15,7 +15,14 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
 #include "algorithm_interface.h"
+#include "../utils/timing.h"
+#include "../utils/histogram.h"
+
+// Forward declaration; defined under "Streaming Result Writer" below
+typedef struct pqc_result_stream pqc_result_stream_t;
 
 // ============================================================================
 // Benchmark Configuration
@@ -30,19 +37,54 @@ typedef enum {
     PQC_OUTPUT_FORMAT_BOTH     ///< Both JSON and CSV
 } pqc_output_format_t;
 
+/**
+ * @brief Measurement mode for the benchmark loops
+ *
+ * Latency mode times every operation individually, which is the most
+ * detailed view but pays one pair of clock reads per sample. Throughput
+ * mode times batches of back-to-back operations, amortizing clock-read
+ * overhead and reporting sustained ops/sec for fast operations.
+ */
+typedef enum {
+    PQC_MEASURE_MODE_LATENCY,     ///< Time each operation individually (default)
+    PQC_MEASURE_MODE_THROUGHPUT   ///< Time batches of batch_size operations
+} pqc_measure_mode_t;
+
 /**
  * @brief Benchmark configuration
- * 
+ *
  * Controls how benchmarks are executed and results are reported.
  */
 typedef struct {
     int num_iterations;              ///< Number of measurement iterations
-    int warmup_iterations;           ///< Number of warmup iterations
+    int warmup_iterations;           ///< Number of warmup iterations (unused when adaptive_warmup is set)
     pqc_output_format_t output_format; ///< Output format
     const char *output_path;         ///< Base path for output files
     bool verbose;                    ///< Enable verbose logging
     bool remove_outliers;            ///< Remove statistical outliers
     double outlier_threshold;        ///< IQR multiplier for outlier detection (default: 1.5)
+    int parallel_workers;            ///< Worker threads for parallel scheduling (<=1 = sequential)
+    pqc_measure_mode_t measure_mode; ///< Latency (per-op) or throughput (batched) measurement
+    int batch_size;                  ///< Operations per timed batch in throughput mode (default: 64)
+    pqc_timing_backend_t timing_backend; ///< Clock source for timestamps (default: monotonic)
+    bool streaming_stats;            ///< Online stats, no per-sample storage (default: false)
+    const char *corpus_dir;          ///< Keypair corpus directory (NULL = live setup keygen)
+    bool perf_counters;              ///< Sample hardware counters per operation (default: false)
+    bool adaptive_sampling;          ///< Stop early once the CI target is met (default: false)
+    double ci_target;                ///< Relative 95% CI half-width target on the mean (default: 0.01)
+    int max_iterations;              ///< Iteration cap in adaptive mode (default: 100000)
+    const size_t *message_sizes;     ///< Sign/verify message sizes to sweep (NULL = default message)
+    int num_message_sizes;           ///< Number of entries in message_sizes
+    bool cold_cache;                 ///< Evict the working set before each timed sample (default: false)
+    int pin_cpu;                     ///< Pin the measurement thread to this core (< 0 = no pinning)
+    bool cpu_telemetry;              ///< Sample cpufreq/thermal sysfs during the run (default: false)
+    double freq_tolerance;           ///< Relative frequency span that flags a result as throttled (default: 0.05)
+    const char *checkpoint_dir;      ///< Spill-file directory for crash-resumable runs (NULL = off)
+    int checkpoint_interval;         ///< Samples between fsync'd progress markers (default: 1000)
+    const char *baseline_dir;        ///< Baseline sample dump directory to gate against (NULL = off)
+    double regression_threshold;     ///< Relative median slowdown that fails the gate (default: 0.05)
+    pqc_result_stream_t *result_stream; ///< Open stream that receives each completed operation (NULL = off)
+    bool adaptive_warmup;            ///< Warm up until a rolling-window median stabilizes instead of a fixed count (default: false)
 } BenchmarkConfig;
 
 // ============================================================================
@@ -59,10 +101,12 @@ typedef struct {
     const char *algorithm;           ///< Algorithm name
     const char *operation;           ///< Operation name
     const char *architecture;        ///< Target architecture (e.g., "native", "arm64")
+    const char *provider;            ///< Providing library (static string, not owned; may be NULL)
     
     // Raw timing data
     uint64_t *samples;               ///< Array of timing samples in nanoseconds
     int num_samples;                 ///< Number of samples
+    size_t message_len;              ///< Message bytes for sign/verify (0 otherwise)
     
     // Computed statistics
     double mean;                     ///< Mean time in microseconds
@@ -72,6 +116,54 @@ typedef struct {
     double max;                      ///< Maximum time in microseconds
     double p95;                      ///< 95th percentile in microseconds
     double p99;                      ///< 99th percentile in microseconds
+
+    // Throughput metrics (amortized over the full measurement run)
+    int batch_size;                  ///< Operations per timed batch (1 in latency mode)
+    double throughput_ops_sec;       ///< Sustained operations per second
+    double amortized_ns_op;          ///< Amortized nanoseconds per operation
+
+    // Tail latency (from the inline HDR histogram, works in streaming mode)
+    double p999;                     ///< 99.9th percentile in microseconds
+    double p9999;                    ///< 99.99th percentile in microseconds
+    pqc_histogram_t histogram;       ///< Log-bucketed latency distribution (ns)
+
+    // Microarchitectural profile (perf_events; all zero when unavailable)
+    bool perf_valid;                 ///< Hardware counters were collected
+    double cycles_per_op;            ///< Average CPU cycles per operation
+    double instructions_per_op;      ///< Average retired instructions per operation
+    double ipc;                      ///< Instructions per cycle
+    double l1d_mpki;                 ///< L1d read misses per 1000 instructions
+    double llc_mpki;                 ///< LLC misses per 1000 instructions
+    double branch_mpki;              ///< Branch mispredictions per 1000 instructions
+
+    // Adaptive sampling outcome (zero when running a fixed iteration count)
+    bool ci_converged;               ///< CI target met before the iteration cap
+    double ci_half_width_rel;        ///< Final relative 95% CI half-width on the mean
+
+    // Cache regime the samples were taken under
+    bool cold_cache;                 ///< Working set evicted before every sample
+
+    // Multi-process contention (0 = single-process measurement)
+    int contention_procs;            ///< Concurrent processes the samples were taken under
+
+    // CPU telemetry summary (all zero when the sampler was off or unavailable)
+    bool telemetry_valid;            ///< Frequency/thermal series was collected
+    double freq_mean_mhz;            ///< Mean core frequency during the run
+    double freq_min_mhz;             ///< Lowest core frequency observed
+    double freq_max_mhz;             ///< Highest core frequency observed
+    double temp_max_c;               ///< Peak temperature across thermal zones
+    bool freq_throttled;             ///< Frequency span exceeded config->freq_tolerance
+
+    // Baseline comparison verdict (all zero when no baseline was loaded)
+    bool regression_checked;         ///< A baseline sample dump was compared against
+    double baseline_median;          ///< Baseline median in microseconds
+    double median_delta;             ///< Relative median change vs baseline (+0.10 = 10% slower)
+    double regression_z;             ///< Mann-Whitney z-score (positive = slower than baseline)
+    bool regressed;                  ///< Slowdown exceeded the threshold with significance
+
+    // Warmup phase outcome
+    int warmup_iterations_used;      ///< Warmup iterations run before the first recorded sample
+    bool warmup_converged;           ///< Warmup median stabilized before the cap (adaptive warmup only)
 } BenchmarkResult;
 
 /**
@@ -86,6 +178,133 @@ typedef struct {
     const char *architecture;        ///< Target architecture
 } BenchmarkResultSet;
 
+// ============================================================================
+// Streaming Result Writer
+// ============================================================================
+
+// User-space accumulation buffer per stream; records build up here and
+// leave as one write per flush
+#define PQC_RESULT_STREAM_BUF_SIZE (1u << 20)
+
+/**
+ * @brief Record framing for a result stream
+ */
+typedef enum {
+    PQC_STREAM_FORMAT_JSONL,   ///< One compact JSON object per line
+    PQC_STREAM_FORMAT_CSV      ///< Header once, then one CSV row per record
+} pqc_result_stream_format_t;
+
+/**
+ * @brief Incremental result writer
+ *
+ * Opened once at campaign start and handed to the engine via
+ * BenchmarkConfig.result_stream; the engine appends each operation's
+ * record the moment its statistics are computed, instead of holding all
+ * output until the campaign ends. Records are line-framed and flushed
+ * per append through a large user-space buffer, so each record leaves
+ * as one large write (NFS-friendly) and a crash mid-campaign loses at
+ * most the record being written: every complete line in the file is a
+ * valid record on its own, and a consumer skips an unparsable tail line.
+ */
+struct pqc_result_stream {
+    FILE *fp;                          ///< Open output file (NULL when closed)
+    char *buf;                         ///< User-space stdio buffer
+    pqc_result_stream_format_t format; ///< Record framing
+    bool include_samples;              ///< Embed raw samples in JSONL records
+    bool header_written;               ///< CSV header line emitted
+    int records_written;               ///< Records appended so far
+    pthread_mutex_t lock;              ///< Parallel workers append concurrently
+};
+
+/**
+ * @brief Open a result stream, truncating any previous file at path
+ * @param stream Stream state to initialize
+ * @param path Output file to create
+ * @param format Record framing (JSONL or CSV)
+ * @param include_samples Embed the raw nanosecond samples in each record
+ *        (JSONL only; ignored with a warning for CSV)
+ * @return 0 on success, negative error code on failure
+ */
+int pqc_result_stream_open(pqc_result_stream_t *stream, const char *path,
+                          pqc_result_stream_format_t format,
+                          bool include_samples);
+
+/**
+ * @brief Append one completed operation's record and flush it
+ * @param stream Open stream
+ * @param result Result with computed statistics
+ * @return 0 on success, negative error code on failure
+ *
+ * Thread-safe; parallel workers may append concurrently. JSONL records
+ * mirror the consolidated JSON fields except the histogram, which stays
+ * in the end-of-campaign output.
+ */
+int pqc_result_stream_append(pqc_result_stream_t *stream,
+                            const BenchmarkResult *result);
+
+/**
+ * @brief Flush and close a result stream
+ * @param stream Stream to close (no-op when not open)
+ * @return 0 on success, negative error code on failure
+ */
+int pqc_result_stream_close(pqc_result_stream_t *stream);
+
+// ============================================================================
+// Direct Measurement Kernels
+// ============================================================================
+
+/**
+ * @brief Buffers handed to a monomorphized measurement kernel
+ *
+ * Mirrors the engine's internal operation context: all buffers are sized
+ * for the algorithm the kernel was registered for and hold valid setup
+ * artifacts (keys, a signature over msg) before the first timed batch.
+ */
+typedef struct {
+    uint8_t *pk;                   ///< Public key buffer
+    uint8_t *sk;                   ///< Secret key buffer
+    uint8_t *ct;                   ///< Ciphertext buffer (KEM)
+    uint8_t *ss;                   ///< Shared secret buffer (KEM)
+    uint8_t *ss_dec;               ///< Decapsulated shared secret buffer (KEM)
+    uint8_t *sig;                  ///< Signature buffer (Signature)
+    size_t sig_cap;                ///< Signature buffer capacity
+    size_t sig_actual_len;         ///< Length of the setup signature
+    const uint8_t *msg;            ///< Message to sign/verify (Signature)
+    size_t msg_len;                ///< Message length (Signature)
+} pqc_direct_buffers_t;
+
+/**
+ * @brief Monomorphized timed batch: direct calls, no pointer dispatch
+ * @param buffers Operation buffers (see pqc_direct_buffers_t)
+ * @param batch Number of back-to-back calls to time
+ * @param elapsed_ns Output: wall time for the whole batch
+ * @return 0 on success, negative error code on failure
+ *
+ * The kernel owns the timestamps around its batch so the measured window
+ * contains only direct calls into the underlying library; per-sample
+ * overhead approaches the bare clock-read cost.
+ */
+typedef int (*pqc_direct_loop_fn)(pqc_direct_buffers_t *buffers, int batch,
+                                  uint64_t *elapsed_ns);
+
+/**
+ * @brief Register a direct kernel for one (algorithm, operation) pair
+ * @param algorithm Algorithm name the kernel is specialized for
+ * @param operation Operation name ("keygen", "encaps", "decaps", "sign",
+ *                  "verify")
+ * @param fn Kernel, or NULL to remove a registration
+ * @return 0 on success, negative error code on failure
+ *
+ * The measurement loop prefers a registered kernel over the generic
+ * function-pointer path whenever the names match; everything around the
+ * timed window (warmup, cold-cache eviction, statistics, counters) is
+ * unchanged. Registration is not thread-safe: register at startup, before
+ * benchmarks run. Both name strings must outlive the registration.
+ */
+int pqc_benchmark_register_direct_loop(const char *algorithm,
+                                       const char *operation,
+                                       pqc_direct_loop_fn fn);
+
 // ============================================================================
 // Benchmark Engine Functions
 // ============================================================================
@@ -102,6 +321,27 @@ typedef struct {
  * - verbose: false
  * - remove_outliers: false
  * - outlier_threshold: 1.5
+ * - parallel_workers: 0 (sequential)
+ * - measure_mode: latency
+ * - batch_size: 64 (used in throughput mode only)
+ * - timing_backend: monotonic
+ * - streaming_stats: false
+ * - corpus_dir: NULL (setup material generated live per operation)
+ * - perf_counters: false (enable for microarchitectural profiling)
+ * - adaptive_sampling: false (num_iterations is exact)
+ * - ci_target: 0.01 (±1% on the mean at 95% confidence)
+ * - max_iterations: 100000 (adaptive-mode cap)
+ * - message_sizes: NULL (sign/verify use the default 24-byte message)
+ * - cold_cache: false (hot-cache regime, no eviction between samples)
+ * - pin_cpu: -1 (measurement thread not pinned)
+ * - cpu_telemetry: false (no frequency/thermal sampling)
+ * - freq_tolerance: 0.05 (flag results when the clock moved more than 5%)
+ * - checkpoint_dir: NULL (no spill files, crash loses the run)
+ * - checkpoint_interval: 1000 (samples between fsync'd progress markers)
+ * - baseline_dir: NULL (no regression gating)
+ * - regression_threshold: 0.05 (fail on a significant 5% median slowdown)
+ * - result_stream: NULL (no incremental record streaming)
+ * - adaptive_warmup: false (fixed warmup iteration count)
  */
 void pqc_benchmark_config_init(BenchmarkConfig *config);
 
@@ -120,9 +360,11 @@ int pqc_benchmark_config_validate(const BenchmarkConfig *config);
  * @return 0 on success, negative error code on failure
  * 
  * Benchmarks all applicable operations for the algorithm:
- * - KEM: keygen, encaps, decaps
- * - Signature: keygen, sign, verify
- * 
+ * - KEM: keygen, encaps, decaps, handshake (composed round-trip)
+ * - Signature: keygen, sign, verify, verify_batch (batch_size distinct
+ *   signatures verified back-to-back under one public key; per-op
+ *   numbers are amortized per signature)
+ *
  * The caller is responsible for freeing the result set using
  * pqc_benchmark_result_set_free().
  */
@@ -133,7 +375,8 @@ int pqc_benchmark_algorithm(const PQCAlgorithm *alg,
 /**
  * @brief Benchmark a specific operation
  * @param alg Algorithm to benchmark
- * @param operation Operation name ("keygen", "encaps", "decaps", "sign", "verify")
+ * @param operation Operation name ("keygen", "encaps", "decaps", "handshake",
+ *                  "sign", "verify", "verify_batch")
  * @param config Benchmark configuration
  * @param result Output: pointer to result (caller must free)
  * @return 0 on success, negative error code on failure
@@ -146,6 +389,93 @@ int pqc_benchmark_operation(const PQCAlgorithm *alg,
                            const BenchmarkConfig *config,
                            BenchmarkResult **result);
 
+/**
+ * @brief Benchmark multiple algorithms with a parallel worker pool
+ * @param algs Array of algorithms to benchmark
+ * @param num_algorithms Number of algorithms in the array
+ * @param config Benchmark configuration (parallel_workers controls pool size)
+ * @param result_sets Output: array of result sets, one per algorithm (caller must free)
+ * @return 0 on success, negative error code on failure
+ *
+ * Fans independent (algorithm, operation) pairs out to config->parallel_workers
+ * threads, each pinned to its own CPU core. Every worker owns the BenchmarkResult
+ * it is filling, so there is no shared mutable state during measurement; results
+ * are merged into per-algorithm BenchmarkResultSet structures afterwards.
+ *
+ * With parallel_workers <= 1 this degrades to the sequential path, which remains
+ * the recommended mode for low-noise measurements.
+ *
+ * The caller is responsible for freeing each result set with
+ * pqc_benchmark_result_set_free() and the array itself with free().
+ */
+int pqc_benchmark_algorithms_parallel(const PQCAlgorithm **algs,
+                                     int num_algorithms,
+                                     const BenchmarkConfig *config,
+                                     BenchmarkResultSet ***result_sets);
+
+/**
+ * @brief Benchmark one operation across several algorithms in one loop
+ * @param algs Array of algorithms to interleave (2-8 entries)
+ * @param num_algorithms Number of algorithms in the array
+ * @param operation Operation name (see pqc_benchmark_operation())
+ * @param config Benchmark configuration (streaming/adaptive not supported)
+ * @param results Output: one result per algorithm (caller must free)
+ * @return 0 on success, negative error code on failure
+ *
+ * Back-to-back runs measure each algorithm under different ambient
+ * conditions: the machine warms up, frequency governors settle, and
+ * co-tenants come and go between runs, so A-versus-B deltas mix real
+ * algorithmic differences with drift. This mode alternates iterations
+ * round-robin between the algorithms inside a single measurement loop,
+ * so any slow drift lands on every distribution equally. Sample i of
+ * every result was taken in the same round, so downstream analysis can
+ * compute paired per-round ratios and confidence intervals instead of
+ * comparing independent summaries.
+ *
+ * All participants must support the operation. Streaming statistics,
+ * adaptive sampling and checkpointing are per-operation features and are
+ * not available here; hardware counters are disabled because one loop
+ * cannot attribute them per algorithm. One telemetry window spans the
+ * whole loop and tags every result identically.
+ *
+ * The caller is responsible for freeing the result set with
+ * pqc_benchmark_result_set_free().
+ */
+int pqc_benchmark_interleaved(const PQCAlgorithm **algs, int num_algorithms,
+                             const char *operation,
+                             const BenchmarkConfig *config,
+                             BenchmarkResultSet **results);
+
+/**
+ * @brief Measure one operation under multi-process memory contention
+ * @param alg Algorithm to benchmark
+ * @param operation Operation name (see pqc_benchmark_operation())
+ * @param config Benchmark configuration (streaming/adaptive not supported)
+ * @param process_counts Scaling curve: concurrent process counts to sweep
+ * @param num_process_counts Number of entries in process_counts
+ * @param results Output: one result per scale point (caller must free)
+ * @return 0 on success, negative error code on failure
+ *
+ * For each N in process_counts the engine forks N identical benchmark
+ * processes, each pinned to its own core and writing its sample stream
+ * into a per-process slot of a shared-memory segment. A shared barrier
+ * releases all processes together so the measured windows overlap. The
+ * parent pools the per-process samples into one result per scale point
+ * (so the latency distribution reflects per-process degradation under
+ * contention), sums per-process throughput into aggregate host
+ * throughput, and tags each result with contention_procs = N.
+ *
+ * Single-process numbers do not predict throughput when many workers
+ * hammer the memory subsystem; the scaling curve from one invocation
+ * replaces external shell orchestration.
+ */
+int pqc_benchmark_contention(const PQCAlgorithm *alg,
+                            const char *operation,
+                            const BenchmarkConfig *config,
+                            const int *process_counts,
+                            int num_process_counts,
+                            BenchmarkResultSet **results);
+
 // ============================================================================
 // Result Management
 // ============================================================================
@@ -155,9 +485,10 @@ int pqc_benchmark_operation(const PQCAlgorithm *alg,
  * @param algorithm Algorithm name
  * @param operation Operation name
  * @param architecture Target architecture
- * @param num_samples Number of samples to allocate
+ * @param num_samples Number of samples to allocate (0 = no sample storage,
+ *                    used by streaming-statistics mode)
  * @return Pointer to allocated result, or NULL on failure
- * 
+ *
  * The caller must free the result using pqc_benchmark_result_free().
  */
 BenchmarkResult* pqc_benchmark_result_alloc(const char *algorithm,
@@ -190,6 +521,18 @@ BenchmarkResultSet* pqc_benchmark_result_set_alloc(const char *algorithm,
  */
 void pqc_benchmark_result_set_free(BenchmarkResultSet *result_set);
 
+/**
+ * @brief Count regressed results in a result set
+ * @param result_set Result set to inspect
+ * @return Number of results whose baseline comparison failed, or negative
+ *         error code on NULL input
+ *
+ * Only meaningful after a run with config->baseline_dir set: results that
+ * were never compared (no baseline file, streaming mode) count as passing.
+ * Drivers use the count as their CI gate and exit nonzero when it is > 0.
+ */
+int pqc_benchmark_result_set_regressions(const BenchmarkResultSet *result_set);
+
 /**
  * @brief Compute statistics for a benchmark result
  * @param result Result to compute statistics for
@@ -222,6 +565,78 @@ int pqc_benchmark_write_json(const BenchmarkResultSet *result_set,
 int pqc_benchmark_write_csv(const BenchmarkResultSet *result_set, 
                            const char *path);
 
+/**
+ * @brief File magic identifying a binary sample dump (not NUL-terminated)
+ */
+#define PQC_SAMPLE_FILE_MAGIC "PQCSMPL1"
+
+/**
+ * @brief On-disk header of a binary sample dump file
+ *
+ * A sample dump file is this header followed immediately by num_samples
+ * host-endian (little-endian on all supported targets) uint64_t timing
+ * samples in nanoseconds. header_size gives the byte offset of the first
+ * sample so loaders can mmap the column without re-deriving the layout.
+ */
+typedef struct {
+    char     magic[8];         ///< PQC_SAMPLE_FILE_MAGIC
+    uint32_t header_size;      ///< Byte offset of the first sample
+    uint32_t sample_width;     ///< Bytes per sample (currently 8)
+    uint64_t num_samples;      ///< Number of samples following the header
+    char     algorithm[32];    ///< NUL-terminated algorithm name
+    char     operation[16];    ///< NUL-terminated operation name
+    char     architecture[16]; ///< NUL-terminated architecture name
+} pqc_sample_file_header_t;
+
+/**
+ * @brief File magic identifying a checkpoint spill file (not NUL-terminated)
+ */
+#define PQC_CHECKPOINT_FILE_MAGIC "PQCCKPT1"
+
+/**
+ * @brief On-disk header of a checkpoint spill file
+ *
+ * A checkpoint file is this header followed by committed_samples
+ * host-endian uint64_t timing samples in nanoseconds, appended as the
+ * measurement loop runs. committed_samples only advances at fsync'd
+ * progress markers (every config->checkpoint_interval samples), so after
+ * a crash the prefix it covers is guaranteed durable; anything appended
+ * past it is discarded on resume. The config fingerprint fields let the
+ * resume path refuse a spill file written under different settings
+ * instead of silently mixing regimes.
+ */
+typedef struct {
+    char     magic[8];          ///< PQC_CHECKPOINT_FILE_MAGIC
+    uint32_t header_size;       ///< Byte offset of the first sample
+    uint32_t sample_width;      ///< Bytes per sample (currently 8)
+    uint64_t committed_samples; ///< Durable samples covered by the last marker
+    uint64_t target_samples;    ///< Samples the full run will produce
+    uint32_t batch_size;        ///< Config fingerprint: operations per batch
+    uint32_t cold_cache;        ///< Config fingerprint: cache regime
+    uint64_t message_len;       ///< Config fingerprint: swept message bytes
+    char     algorithm[32];     ///< NUL-terminated algorithm name
+    char     operation[16];     ///< NUL-terminated operation name
+    char     architecture[16];  ///< NUL-terminated architecture name
+} pqc_checkpoint_header_t;
+
+/**
+ * @brief Write raw timing samples as binary columnar files
+ * @param result_set Result set whose samples should be dumped
+ * @param dir Output directory (must exist)
+ * @return 0 on success, negative error code on failure
+ *
+ * Writes one file per operation named
+ * "<algorithm>_<operation>_<architecture>.samples", each a
+ * pqc_sample_file_header_t followed by the raw uint64_t sample column in
+ * a single sequential write. Results without stored samples (streaming
+ * statistics mode) are skipped with a warning.
+ *
+ * The companion loader in src/analysis/sample_loader.py maps these files
+ * into numpy arrays without copying.
+ */
+int pqc_benchmark_write_samples(const BenchmarkResultSet *result_set,
+                               const char *dir);
+
 /**
  * @brief Print results to stdout
  * @param result_set Result set to print
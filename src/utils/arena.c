@@ -0,0 +1,100 @@
+/**
+ * @file arena.c
+ * @brief Implementation of the bump-pointer arena allocator
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#include "arena.h"
+#include "logger.h"
+#include "../core/error_codes.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// Arena Functions
+// ============================================================================
+
+int pqc_arena_init(pqc_arena_t *arena, size_t capacity) {
+    if (arena == NULL) {
+        LOG_ERROR("Arena is NULL");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    // Leave the arena in a destroyable state even if initialization fails
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->offset = 0;
+
+    if (capacity == 0) {
+        LOG_ERROR("Invalid arena capacity: 0");
+        return PQC_ERROR_INVALID_PARAM;
+    }
+
+    arena->base = (uint8_t*)malloc(capacity);
+    if (arena->base == NULL) {
+        LOG_ERROR("Failed to reserve %zu byte arena", capacity);
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+
+    arena->capacity = capacity;
+    arena->offset = 0;
+
+    LOG_DEBUG("Arena initialized: %zu bytes", capacity);
+
+    return PQC_SUCCESS;
+}
+
+void* pqc_arena_alloc(pqc_arena_t *arena, size_t size) {
+    if (arena == NULL || arena->base == NULL) {
+        LOG_ERROR("Allocation from uninitialized arena");
+        return NULL;
+    }
+
+    if (size == 0) {
+        LOG_ERROR("Invalid allocation size: 0");
+        return NULL;
+    }
+
+    // Round the request up so the next block stays aligned
+    size_t aligned = (size + (PQC_ARENA_ALIGNMENT - 1)) &
+                     ~((size_t)(PQC_ARENA_ALIGNMENT - 1));
+
+    if (aligned > arena->capacity - arena->offset) {
+        LOG_ERROR("Arena exhausted: %zu bytes requested, %zu available",
+                  size, arena->capacity - arena->offset);
+        return NULL;
+    }
+
+    void *block = arena->base + arena->offset;
+    arena->offset += aligned;
+
+    return block;
+}
+
+void pqc_arena_reset(pqc_arena_t *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    arena->offset = 0;
+}
+
+void pqc_arena_destroy(pqc_arena_t *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    free(arena->base);
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->offset = 0;
+}
+
+size_t pqc_arena_used(const pqc_arena_t *arena) {
+    if (arena == NULL) {
+        return 0;
+    }
+
+    return arena->offset;
+}
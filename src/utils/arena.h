@@ -0,0 +1,84 @@
+/**
+ * @file arena.h
+ * @brief Bump-pointer arena allocator for benchmark buffers
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Provides a simple region allocator: one upfront malloc, then O(1)
+ * aligned carve-outs and an O(1) reset that recycles the whole region.
+ * The benchmark engine uses a per-campaign arena for operation buffers
+ * (pk/sk/ct/ss/sig) so repeated operations do not touch the system
+ * allocator and the cache state entering the measured region stays
+ * consistent between runs.
+ */
+
+#ifndef PQC_ARENA_H
+#define PQC_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// Data Types
+// ============================================================================
+
+/**
+ * @brief Alignment of every allocation returned by pqc_arena_alloc()
+ */
+#define PQC_ARENA_ALIGNMENT 16
+
+/**
+ * @brief Bump-pointer arena backed by a single heap reservation
+ */
+typedef struct {
+    uint8_t *base;          ///< Start of the reserved region
+    size_t   capacity;      ///< Total reserved bytes
+    size_t   offset;        ///< Bytes handed out so far (aligned)
+} pqc_arena_t;
+
+// ============================================================================
+// Arena Functions
+// ============================================================================
+
+/**
+ * @brief Initialize an arena with a single upfront reservation
+ * @param arena Arena to initialize
+ * @param capacity Bytes to reserve
+ * @return 0 on success, negative error code on failure
+ */
+int pqc_arena_init(pqc_arena_t *arena, size_t capacity);
+
+/**
+ * @brief Carve an aligned block out of the arena
+ * @param arena Arena to allocate from
+ * @param size Bytes requested
+ * @return Pointer to the block, or NULL if the arena is exhausted
+ *
+ * Blocks are aligned to PQC_ARENA_ALIGNMENT and are valid until the next
+ * pqc_arena_reset() or pqc_arena_destroy(). There is no per-block free.
+ */
+void* pqc_arena_alloc(pqc_arena_t *arena, size_t size);
+
+/**
+ * @brief Recycle the whole arena without releasing the reservation
+ * @param arena Arena to reset (may be NULL)
+ *
+ * All previously carved blocks become invalid; subsequent allocations
+ * reuse the region from the start.
+ */
+void pqc_arena_reset(pqc_arena_t *arena);
+
+/**
+ * @brief Release the arena's reservation
+ * @param arena Arena to destroy (may be NULL)
+ */
+void pqc_arena_destroy(pqc_arena_t *arena);
+
+/**
+ * @brief Bytes currently handed out (including alignment padding)
+ * @param arena Arena to inspect
+ * @return Used bytes, or 0 if arena is NULL
+ */
+size_t pqc_arena_used(const pqc_arena_t *arena);
+
+#endif // PQC_ARENA_H
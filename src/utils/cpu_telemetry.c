@@ -0,0 +1,226 @@
+/**
+ * @file cpu_telemetry.c
+ * @brief CPU frequency and thermal telemetry implementation
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#include "cpu_telemetry.h"
+#include "../core/error_codes.h"
+#include "logger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+// ============================================================================
+// Sysfs Readers
+// ============================================================================
+
+/**
+ * @brief Read an integer from an already-open sysfs file
+ * @return Parsed value, or -1 on read/parse failure
+ *
+ * Uses pread() so the fd can be reused every tick without reopening.
+ */
+static long read_sysfs_long(int fd) {
+    char buf[32];
+
+    ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (n <= 0) {
+        return -1;
+    }
+    buf[n] = '\0';
+
+    char *end = NULL;
+    long value = strtol(buf, &end, 10);
+    if (end == buf) {
+        return -1;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Take one telemetry reading and fold it into series and summary
+ */
+static void telemetry_sample_once(pqc_cpu_telemetry_t *t) {
+    long freq = (t->freq_fd >= 0) ? read_sysfs_long(t->freq_fd) : -1;
+
+    // Track the hottest zone: package sensors and per-core sensors vary
+    // across boards, and throttling follows the hottest one
+    long temp = -1;
+    for (int i = 0; i < t->num_temp_fds; i++) {
+        long zone = read_sysfs_long(t->temp_fds[i]);
+        if (zone > temp) {
+            temp = zone;
+        }
+    }
+
+    if (freq < 0 && temp < 0) {
+        return;
+    }
+
+    if (t->num_series < PQC_TELEMETRY_MAX_SAMPLES) {
+        t->freq_khz[t->num_series] = (freq >= 0) ? (uint32_t)freq : 0;
+        t->temp_mc[t->num_series] = (temp >= 0) ? (int32_t)temp : 0;
+        t->num_series++;
+    }
+
+    t->num_samples++;
+
+    if (freq >= 0) {
+        uint32_t f = (uint32_t)freq;
+        if (t->freq_min_khz == 0 || f < t->freq_min_khz) {
+            t->freq_min_khz = f;
+        }
+        if (f > t->freq_max_khz) {
+            t->freq_max_khz = f;
+        }
+        t->freq_sum_khz += (double)f;
+    }
+
+    if (temp > t->temp_max_mc) {
+        t->temp_max_mc = (int32_t)temp;
+    }
+}
+
+/**
+ * @brief Sampler thread: one reading per interval until stopped
+ */
+static void* telemetry_thread(void *arg) {
+    pqc_cpu_telemetry_t *t = (pqc_cpu_telemetry_t*)arg;
+
+    struct timespec interval = {
+        .tv_sec = t->interval_ms / 1000,
+        .tv_nsec = (long)(t->interval_ms % 1000) * 1000000L
+    };
+
+    while (__atomic_load_n(&t->running, __ATOMIC_ACQUIRE)) {
+        telemetry_sample_once(t);
+        nanosleep(&interval, NULL);
+    }
+
+    return NULL;
+}
+
+// ============================================================================
+// Sampler Control
+// ============================================================================
+
+int pqc_cpu_telemetry_start(pqc_cpu_telemetry_t *telemetry, int cpu,
+                           int interval_ms) {
+    if (telemetry == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    memset(telemetry, 0, sizeof(*telemetry));
+    telemetry->cpu = (cpu >= 0) ? cpu : 0;
+    telemetry->interval_ms = (interval_ms > 0) ? interval_ms : 50;
+    telemetry->freq_fd = -1;
+
+    char path[128];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq",
+             telemetry->cpu);
+    telemetry->freq_fd = open(path, O_RDONLY);
+
+    for (int zone = 0;
+         zone < (int)(sizeof(telemetry->temp_fds) / sizeof(telemetry->temp_fds[0]));
+         zone++) {
+        snprintf(path, sizeof(path), "/sys/class/thermal/thermal_zone%d/temp",
+                 zone);
+        int fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            break;  // Zones are numbered contiguously
+        }
+        telemetry->temp_fds[telemetry->num_temp_fds++] = fd;
+    }
+
+    if (telemetry->freq_fd < 0 && telemetry->num_temp_fds == 0) {
+        LOG_DEBUG("No cpufreq or thermal sysfs available, telemetry disabled");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    // Baseline reading before the run starts
+    telemetry_sample_once(telemetry);
+
+    __atomic_store_n(&telemetry->running, 1, __ATOMIC_RELEASE);
+    if (pthread_create(&telemetry->thread, NULL, telemetry_thread,
+                       telemetry) != 0) {
+        LOG_WARN("Failed to start telemetry sampler thread");
+        pqc_cpu_telemetry_stop(telemetry);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    LOG_DEBUG("Telemetry sampler started (cpu=%d, interval=%d ms, %d zones)",
+              telemetry->cpu, telemetry->interval_ms, telemetry->num_temp_fds);
+
+    return PQC_SUCCESS;
+}
+
+void pqc_cpu_telemetry_stop(pqc_cpu_telemetry_t *telemetry) {
+    if (telemetry == NULL) {
+        return;
+    }
+
+    if (__atomic_load_n(&telemetry->running, __ATOMIC_ACQUIRE)) {
+        __atomic_store_n(&telemetry->running, 0, __ATOMIC_RELEASE);
+        pthread_join(telemetry->thread, NULL);
+    }
+
+    // Closing reading so short runs still get a start/end pair
+    if (telemetry->freq_fd >= 0 || telemetry->num_temp_fds > 0) {
+        telemetry_sample_once(telemetry);
+    }
+
+    if (telemetry->freq_fd >= 0) {
+        close(telemetry->freq_fd);
+        telemetry->freq_fd = -1;
+    }
+    for (int i = 0; i < telemetry->num_temp_fds; i++) {
+        close(telemetry->temp_fds[i]);
+    }
+    telemetry->num_temp_fds = 0;
+}
+
+#else  // !__linux__
+
+// ============================================================================
+// Stub Implementation (non-Linux)
+// ============================================================================
+
+int pqc_cpu_telemetry_start(pqc_cpu_telemetry_t *telemetry, int cpu,
+                           int interval_ms) {
+    if (telemetry == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    memset(telemetry, 0, sizeof(*telemetry));
+    telemetry->cpu = cpu;
+    telemetry->interval_ms = interval_ms;
+    telemetry->freq_fd = -1;
+
+    return PQC_ERROR_NOT_SUPPORTED;
+}
+
+void pqc_cpu_telemetry_stop(pqc_cpu_telemetry_t *telemetry) {
+    (void)telemetry;
+}
+
+#endif  // __linux__
+
+double pqc_cpu_telemetry_freq_span(const pqc_cpu_telemetry_t *telemetry) {
+    if (telemetry == NULL || telemetry->freq_max_khz == 0) {
+        return 0.0;
+    }
+
+    return (double)(telemetry->freq_max_khz - telemetry->freq_min_khz) /
+           (double)telemetry->freq_max_khz;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file cpu_telemetry.h
+ * @brief CPU frequency and thermal telemetry sampled during benchmark runs
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Low-overhead sampler thread that periodically reads cpufreq and
+ * thermal-zone sysfs values while a measurement loop runs. The series is
+ * retained in a bounded in-memory buffer and summarized (min/mean/max
+ * frequency, peak temperature) so results can be flagged when DVFS or
+ * thermal throttling moved the clock under the samples. On platforms
+ * without the sysfs interfaces the sampler degrades to "not supported"
+ * and measurements proceed without telemetry.
+ */
+
+#ifndef PQC_CPU_TELEMETRY_H
+#define PQC_CPU_TELEMETRY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+// ============================================================================
+// Telemetry Series
+// ============================================================================
+
+/**
+ * @brief Maximum retained telemetry readings per run
+ *
+ * At the default 50 ms period this covers runs of several minutes; the
+ * sampler keeps accumulating summary statistics after the series fills.
+ */
+#define PQC_TELEMETRY_MAX_SAMPLES 4096
+
+/**
+ * @brief Telemetry sampler state and collected series
+ *
+ * The sampler thread is the only writer while running; read the results
+ * only after pqc_cpu_telemetry_stop() has joined it.
+ */
+typedef struct {
+    // Configuration
+    int cpu;                    ///< Monitored CPU (cpufreq policy of this core)
+    int interval_ms;            ///< Sampling period in milliseconds
+
+    // Retained series (parallel arrays, num_series entries)
+    uint32_t freq_khz[PQC_TELEMETRY_MAX_SAMPLES];  ///< scaling_cur_freq readings
+    int32_t temp_mc[PQC_TELEMETRY_MAX_SAMPLES];    ///< Hottest zone, millidegrees C
+    int num_series;             ///< Readings retained in the series
+
+    // Summary over all readings (including any past the series cap)
+    int num_samples;            ///< Total readings taken
+    uint32_t freq_min_khz;      ///< Lowest frequency observed
+    uint32_t freq_max_khz;      ///< Highest frequency observed
+    double freq_sum_khz;        ///< Sum of readings (for the mean)
+    int32_t temp_max_mc;        ///< Peak temperature observed
+
+    // Internal sampler state
+    pthread_t thread;           ///< Sampler thread
+    int running;                ///< Nonzero while the sampler is active
+    int freq_fd;                ///< Open fd on scaling_cur_freq (-1 if absent)
+    int temp_fds[8];            ///< Open fds on thermal_zone*/temp
+    int num_temp_fds;           ///< Number of open thermal zone fds
+} pqc_cpu_telemetry_t;
+
+// ============================================================================
+// Sampler Control
+// ============================================================================
+
+/**
+ * @brief Start the telemetry sampler thread
+ * @param telemetry Sampler state to initialize (fully overwritten)
+ * @param cpu CPU whose cpufreq policy to monitor (< 0 = CPU 0)
+ * @param interval_ms Sampling period in milliseconds (<= 0 = 50)
+ * @return 0 on success, PQC_ERROR_NOT_SUPPORTED when neither cpufreq nor
+ *         thermal sysfs is readable, negative error code otherwise
+ */
+int pqc_cpu_telemetry_start(pqc_cpu_telemetry_t *telemetry, int cpu,
+                           int interval_ms);
+
+/**
+ * @brief Stop the sampler and join its thread
+ * @param telemetry Running sampler (no-op when not running)
+ *
+ * After this returns the series and summary fields are stable and a
+ * final reading has been taken, so even very short runs get at least
+ * two data points.
+ */
+void pqc_cpu_telemetry_stop(pqc_cpu_telemetry_t *telemetry);
+
+/**
+ * @brief Relative frequency span observed during the run
+ * @param telemetry Stopped sampler
+ * @return (max - min) / max, or 0.0 without frequency readings
+ *
+ * This is the quantity compared against the configured tolerance to flag
+ * throttled results: a clock that never moved yields 0.
+ */
+double pqc_cpu_telemetry_freq_span(const pqc_cpu_telemetry_t *telemetry);
+
+#endif // PQC_CPU_TELEMETRY_H
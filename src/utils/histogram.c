@@ -0,0 +1,122 @@
+/**
+ * @file histogram.c
+ * @brief Implementation of the log-bucketed latency histogram
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#include "histogram.h"
+#include <string.h>
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+/**
+ * @brief Bucket index for a value, or -1 if it overflows the last range
+ *
+ * Range 0 is linear (one bucket per nanosecond up to 31 ns); every later
+ * range spans one power of two split into 32 linear sub-buckets, keeping
+ * the relative bucket width at or below 1/32.
+ */
+static int bucket_index(uint64_t value) {
+    if (value < PQC_HIST_SUBBUCKETS) {
+        return (int)value;
+    }
+
+    // Position of the most significant bit (>= PQC_HIST_SUBBUCKET_BITS here)
+    int msb = 63 - __builtin_clzll(value);
+    int range = msb - PQC_HIST_SUBBUCKET_BITS + 1;
+
+    if (range >= PQC_HIST_RANGES) {
+        return -1;
+    }
+
+    // The SUBBUCKET_BITS bits below the MSB select the linear sub-bucket
+    int sub = (int)((value >> (msb - PQC_HIST_SUBBUCKET_BITS)) &
+                    (PQC_HIST_SUBBUCKETS - 1));
+
+    return range * (int)PQC_HIST_SUBBUCKETS + sub;
+}
+
+// ============================================================================
+// Histogram Functions
+// ============================================================================
+
+void pqc_histogram_init(pqc_histogram_t *hist) {
+    memset(hist, 0, sizeof(*hist));
+}
+
+void pqc_histogram_record(pqc_histogram_t *hist, uint64_t value) {
+    int index = bucket_index(value);
+
+    if (index < 0) {
+        hist->overflow++;
+    } else {
+        hist->counts[index]++;
+    }
+
+    hist->count++;
+}
+
+void pqc_histogram_bucket_bounds(int index, uint64_t *lower, uint64_t *upper) {
+    int range = index / (int)PQC_HIST_SUBBUCKETS;
+    int sub = index % (int)PQC_HIST_SUBBUCKETS;
+
+    uint64_t lo, width;
+
+    if (range == 0) {
+        lo = (uint64_t)sub;
+        width = 1;
+    } else {
+        width = 1ULL << (range - 1);
+        lo = ((uint64_t)PQC_HIST_SUBBUCKETS + (uint64_t)sub) * width;
+    }
+
+    if (lower != NULL) {
+        *lower = lo;
+    }
+    if (upper != NULL) {
+        *upper = lo + width;
+    }
+}
+
+double pqc_histogram_percentile(const pqc_histogram_t *hist, double percentile) {
+    if (hist == NULL || hist->count == 0 ||
+        percentile < 0.0 || percentile > 100.0) {
+        return 0.0;
+    }
+
+    uint64_t target = (uint64_t)((percentile / 100.0) * (double)hist->count);
+    if (target >= hist->count) {
+        target = hist->count - 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < (int)PQC_HIST_NUM_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen > target) {
+            uint64_t lo, hi;
+            pqc_histogram_bucket_bounds(i, &lo, &hi);
+            return (double)lo + (double)(hi - lo) / 2.0;
+        }
+    }
+
+    // Target falls in the overflow counter: report the covered maximum
+    uint64_t lo, hi;
+    pqc_histogram_bucket_bounds(PQC_HIST_NUM_BUCKETS - 1, &lo, &hi);
+    return (double)hi;
+}
+
+void pqc_histogram_merge(pqc_histogram_t *dst, const pqc_histogram_t *src) {
+    if (dst == NULL || src == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < (int)PQC_HIST_NUM_BUCKETS; i++) {
+        dst->counts[i] += src->counts[i];
+    }
+
+    dst->overflow += src->overflow;
+    dst->count += src->count;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file histogram.h
+ * @brief Log-bucketed high-dynamic-range latency histogram
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Fixed-size histogram covering nanosecond latencies from 1 ns to ~4.8
+ * hours with <= ~3% relative bucket width (32 sub-buckets per power of
+ * two). Recording is a few shifts and one counter increment with no
+ * allocation, so the measurement loops can accumulate it inline, and the
+ * structure is small enough to embed in every BenchmarkResult. This is
+ * what exposes tail shape (p99.9/p99.99, bimodality) that a seven-number
+ * summary hides.
+ */
+
+#ifndef PQC_HISTOGRAM_H
+#define PQC_HISTOGRAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// Histogram Layout
+// ============================================================================
+
+/**
+ * @brief Sub-bucket resolution: 2^5 = 32 linear sub-buckets per power of two
+ */
+#define PQC_HIST_SUBBUCKET_BITS 5
+
+/**
+ * @brief Linear sub-buckets per power-of-two range
+ */
+#define PQC_HIST_SUBBUCKETS (1u << PQC_HIST_SUBBUCKET_BITS)
+
+/**
+ * @brief Number of power-of-two ranges (range 0 is linear 0..31 ns)
+ */
+#define PQC_HIST_RANGES 40
+
+/**
+ * @brief Total bucket count (40 ranges x 32 sub-buckets)
+ */
+#define PQC_HIST_NUM_BUCKETS (PQC_HIST_RANGES * PQC_HIST_SUBBUCKETS)
+
+// ============================================================================
+// Data Types
+// ============================================================================
+
+/**
+ * @brief Fixed-size log-bucketed latency histogram (values in nanoseconds)
+ */
+typedef struct {
+    uint64_t count;                            ///< Total values recorded
+    uint64_t overflow;                         ///< Values beyond the last bucket
+    uint64_t counts[PQC_HIST_NUM_BUCKETS];     ///< Per-bucket counters
+} pqc_histogram_t;
+
+// ============================================================================
+// Histogram Functions
+// ============================================================================
+
+/**
+ * @brief Reset a histogram to empty
+ * @param hist Histogram to initialize (may not be NULL)
+ */
+void pqc_histogram_init(pqc_histogram_t *hist);
+
+/**
+ * @brief Record one value
+ * @param hist Histogram to update
+ * @param value Value in nanoseconds
+ *
+ * O(1), allocation-free; values beyond the covered range land in the
+ * overflow counter.
+ */
+void pqc_histogram_record(pqc_histogram_t *hist, uint64_t value);
+
+/**
+ * @brief Estimate a percentile from the recorded distribution
+ * @param hist Histogram to query
+ * @param percentile Percentile in [0, 100]
+ * @return Estimated value in nanoseconds (bucket midpoint), 0 if empty
+ */
+double pqc_histogram_percentile(const pqc_histogram_t *hist, double percentile);
+
+/**
+ * @brief Lower and upper bounds (ns) of a bucket
+ * @param index Bucket index in [0, PQC_HIST_NUM_BUCKETS)
+ * @param lower Output: inclusive lower bound (may be NULL)
+ * @param upper Output: exclusive upper bound (may be NULL)
+ */
+void pqc_histogram_bucket_bounds(int index, uint64_t *lower, uint64_t *upper);
+
+/**
+ * @brief Merge another histogram into this one
+ * @param dst Destination histogram
+ * @param src Histogram to add (unchanged)
+ */
+void pqc_histogram_merge(pqc_histogram_t *dst, const pqc_histogram_t *src);
+
+#endif // PQC_HISTOGRAM_H
@@ -6,6 +6,8 @@
 #include "logger.h"
 #include <sys/time.h>
 #include <unistd.h>
+#include <stdatomic.h>
+#include <pthread.h>
 
 // ============================================================================
 // Variables Globales
@@ -19,6 +21,34 @@ logger_config_t g_logger_config = {
     .include_source_info = 0
 };
 
+// ============================================================================
+// Backend Asíncrono (ring buffer MPSC sin bloqueos)
+// ============================================================================
+
+// Capacidad del ring (potencia de dos para enmascarar los índices)
+#define LOG_RING_SIZE 4096
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+
+// Un registro preformateado; el hilo de drenaje reconstruye la salida
+// exactamente igual que la ruta síncrona
+typedef struct {
+    _Atomic size_t seq;         ///< Secuencia del slot (protocolo Vyukov)
+    log_level_t level;          ///< Nivel del mensaje
+    int line;                   ///< Línea fuente
+    char timestamp[32];         ///< Timestamp preformateado ("" si desactivado)
+    char filename[64];          ///< Nombre de archivo fuente
+    char func[64];              ///< Función fuente
+    char message[512];          ///< Mensaje ya formateado (truncado si excede)
+} log_record_t;
+
+static log_record_t g_log_ring[LOG_RING_SIZE];
+static _Atomic size_t g_log_head = 0;          ///< Posición de encolado (productores)
+static _Atomic size_t g_log_tail = 0;          ///< Posición de drenaje (escribe el consumidor, lee logger_flush)
+static _Atomic size_t g_log_dropped = 0;       ///< Mensajes descartados por ring lleno
+static _Atomic int g_log_async_running = 0;    ///< 1 mientras el hilo de drenaje vive
+static _Atomic int g_log_async_stop = 0;       ///< Señal de parada para el drenaje
+static pthread_t g_log_drain_thread;
+
 // ============================================================================
 // Implementaciones
 // ============================================================================
@@ -40,6 +70,9 @@ void logger_init(logger_config_t config) {
 }
 
 void logger_close(void) {
+    // Drenar los mensajes pendientes antes de cerrar el archivo
+    logger_async_stop();
+
     if (g_logger_config.file_output != NULL) {
         char timestamp[64];
         logger_get_timestamp(timestamp, sizeof(timestamp));
@@ -115,35 +148,19 @@ const char* logger_level_to_color(log_level_t level) {
     }
 }
 
-void logger_log(log_level_t level, const char *file, int line, 
-                const char *func, const char *format, ...) {
-    
-    // Filtrar por nivel mínimo
-    if (level < g_logger_config.min_level) {
-        return;
-    }
-    
-    // Preparar timestamp
-    char timestamp[64] = "";
-    if (g_logger_config.include_timestamp) {
-        logger_get_timestamp(timestamp, sizeof(timestamp));
-    }
-    
-    // Preparar mensaje
-    char message[4096];
-    va_list args;
-    va_start(args, format);
-    vsnprintf(message, sizeof(message), format, args);
-    va_end(args);
-    
-    // Extraer solo nombre de archivo (sin path completo)
-    const char *filename = strrchr(file, '/');
-    filename = (filename != NULL) ? filename + 1 : file;
-    
+/**
+ * @brief Emite un registro ya formateado a consola y archivo
+ *
+ * Ruta de E/S compartida por el logging síncrono y el hilo de drenaje
+ * del backend asíncrono, para que la salida sea idéntica en ambos modos.
+ */
+static void logger_emit(log_level_t level, const char *timestamp,
+                        const char *filename, int line, const char *func,
+                        const char *message, int flush) {
     // ========================================================================
     // Salida a Consola
     // ========================================================================
-    
+
     if (g_logger_config.use_colors) {
         // Con colores
         fprintf(stdout, "%s[%s]%s ", 
@@ -175,8 +192,10 @@ void logger_log(log_level_t level, const char *file, int line,
         
         fprintf(stdout, "%s\n", message);
     }
-    
-    fflush(stdout);
+
+    if (flush) {
+        fflush(stdout);
+    }
     
     // ========================================================================
     // Salida a Archivo (sin colores)
@@ -196,12 +215,223 @@ void logger_log(log_level_t level, const char *file, int line,
         }
         
         fprintf(g_logger_config.file_output, "%s\n", message);
+        if (flush) {
+            fflush(g_logger_config.file_output);
+        }
+    }
+}
+
+/**
+ * @brief Copia acotada con truncado silencioso (los campos del ring
+ *        tienen tamaño fijo)
+ */
+static void logger_copy_field(char *dst, size_t dst_size, const char *src) {
+    size_t i = 0;
+    while (i + 1 < dst_size && src[i] != '\0') {
+        dst[i] = src[i];
+        i++;
+    }
+    dst[i] = '\0';
+}
+
+/**
+ * @brief Encola un registro en el ring MPSC (protocolo de Vyukov)
+ * @return 1 si se encoló, 0 si el ring está lleno
+ */
+static int logger_enqueue(log_level_t level, const char *timestamp,
+                          const char *filename, int line, const char *func,
+                          const char *message) {
+    size_t pos = atomic_load_explicit(&g_log_head, memory_order_relaxed);
+
+    for (;;) {
+        log_record_t *cell = &g_log_ring[pos & LOG_RING_MASK];
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+
+        if (dif == 0) {
+            // Slot libre: reclamarlo avanzando head
+            if (atomic_compare_exchange_weak_explicit(
+                    &g_log_head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                cell->level = level;
+                cell->line = line;
+                logger_copy_field(cell->timestamp, sizeof(cell->timestamp),
+                                  timestamp);
+                logger_copy_field(cell->filename, sizeof(cell->filename),
+                                  filename);
+                logger_copy_field(cell->func, sizeof(cell->func), func);
+                logger_copy_field(cell->message, sizeof(cell->message),
+                                  message);
+                atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+                return 1;
+            }
+        } else if (dif < 0) {
+            // Ring lleno: descartar en vez de bloquear el hot path
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&g_log_head, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Extrae y emite el siguiente registro pendiente (solo consumidor)
+ * @return 1 si se emitió un registro, 0 si el ring está vacío
+ */
+static int logger_drain_one(void) {
+    // Único escritor de g_log_tail: la carga relajada lee su propio valor
+    size_t tail = atomic_load_explicit(&g_log_tail, memory_order_relaxed);
+    log_record_t *cell = &g_log_ring[tail & LOG_RING_MASK];
+    size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+
+    if ((intptr_t)seq - (intptr_t)(tail + 1) != 0) {
+        return 0;
+    }
+
+    // El hilo de drenaje difiere los flush hasta vaciar el ring
+    logger_emit(cell->level, cell->timestamp, cell->filename, cell->line,
+                cell->func, cell->message, 0);
+
+    // Liberar el slot para la siguiente vuelta del ring y publicar el
+    // avance para las esperas de logger_flush
+    atomic_store_explicit(&cell->seq, tail + LOG_RING_SIZE,
+                          memory_order_release);
+    atomic_store_explicit(&g_log_tail, tail + 1, memory_order_release);
+
+    return 1;
+}
+
+/**
+ * @brief Hilo dedicado de drenaje: realiza toda la E/S del logger
+ */
+static void* logger_drain_thread(void *arg) {
+    (void)arg;
+
+    const struct timespec idle = { .tv_sec = 0, .tv_nsec = 1000000 };  // 1 ms
+
+    for (;;) {
+        if (!logger_drain_one()) {
+            // Ring vacío: publicar lo acumulado antes de dormir
+            fflush(stdout);
+            if (g_logger_config.file_output != NULL) {
+                fflush(g_logger_config.file_output);
+            }
+            if (atomic_load_explicit(&g_log_async_stop, memory_order_acquire)) {
+                break;
+            }
+            nanosleep(&idle, NULL);
+        }
+    }
+
+    // Drenaje final tras la señal de parada
+    while (logger_drain_one()) {
+    }
+    fflush(stdout);
+    if (g_logger_config.file_output != NULL) {
         fflush(g_logger_config.file_output);
     }
-    
+
+    return NULL;
+}
+
+int logger_async_start(void) {
+    if (atomic_load(&g_log_async_running)) {
+        return 0;
+    }
+
+    // Secuencias iniciales del protocolo: slot i disponible en la vuelta i
+    for (size_t i = 0; i < LOG_RING_SIZE; i++) {
+        atomic_store_explicit(&g_log_ring[i].seq, i, memory_order_relaxed);
+    }
+    atomic_store(&g_log_head, 0);
+    atomic_store(&g_log_tail, 0);
+    atomic_store(&g_log_dropped, 0);
+    atomic_store(&g_log_async_stop, 0);
+
+    if (pthread_create(&g_log_drain_thread, NULL, logger_drain_thread, NULL) != 0) {
+        return -1;
+    }
+
+    atomic_store(&g_log_async_running, 1);
+
+    return 0;
+}
+
+void logger_flush(void) {
+    if (!atomic_load(&g_log_async_running)) {
+        return;
+    }
+
+    // Esperar a que el consumidor alcance la posición de encolado actual
+    size_t target = atomic_load(&g_log_head);
+    const struct timespec idle = { .tv_sec = 0, .tv_nsec = 100000 };  // 0.1 ms
+    while (atomic_load_explicit(&g_log_tail, memory_order_relaxed) < target &&
+           atomic_load(&g_log_async_running)) {
+        nanosleep(&idle, NULL);
+    }
+}
+
+void logger_async_stop(void) {
+    if (!atomic_load(&g_log_async_running)) {
+        return;
+    }
+
+    atomic_store_explicit(&g_log_async_stop, 1, memory_order_release);
+    pthread_join(g_log_drain_thread, NULL);
+    atomic_store(&g_log_async_running, 0);
+
+    size_t dropped = atomic_load(&g_log_dropped);
+    if (dropped > 0) {
+        fprintf(stderr, "[WARN ] logger: %zu mensajes descartados "
+                "(ring lleno)\n", dropped);
+    }
+}
+
+void logger_log(log_level_t level, const char *file, int line,
+                const char *func, const char *format, ...) {
+
+    // Filtrar por nivel mínimo
+    if (level < g_logger_config.min_level) {
+        return;
+    }
+
+    // Preparar timestamp
+    char timestamp[64] = "";
+    if (g_logger_config.include_timestamp) {
+        logger_get_timestamp(timestamp, sizeof(timestamp));
+    }
+
+    // Preparar mensaje
+    char message[4096];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    // Extraer solo nombre de archivo (sin path completo)
+    const char *filename = strrchr(file, '/');
+    filename = (filename != NULL) ? filename + 1 : file;
+
+    if (atomic_load_explicit(&g_log_async_running, memory_order_acquire) &&
+        level != LOG_LEVEL_FATAL) {
+        // Ruta asíncrona: el costo se reduce al formateo y una escritura
+        // en el ring; la E/S queda en el hilo de drenaje
+        if (!logger_enqueue(level, timestamp, filename, line, func, message)) {
+            atomic_fetch_add_explicit(&g_log_dropped, 1, memory_order_relaxed);
+        }
+        return;
+    }
+
+    // FATAL nunca se encola: debe salir antes de terminar el programa
+    if (level == LOG_LEVEL_FATAL) {
+        logger_flush();
+    }
+
+    logger_emit(level, timestamp, filename, line, func, message, 1);
+
     // Terminar programa si es FATAL
     if (level == LOG_LEVEL_FATAL) {
-        fprintf(stderr, "\n%sFATAL ERROR - Program terminated%s\n", 
+        fprintf(stderr, "\n%sFATAL ERROR - Program terminated%s\n",
                 COLOR_RED, COLOR_RESET);
         logger_close();
         exit(EXIT_FAILURE);
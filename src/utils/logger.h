@@ -73,9 +73,36 @@ void logger_init(logger_config_t config);
 
 /**
  * @brief Cierra el sistema de logging
+ *
+ * Detiene el backend asíncrono (si está activo) drenando todos los
+ * mensajes pendientes antes de cerrar el archivo.
  */
 void logger_close(void);
 
+/**
+ * @brief Activa el backend asíncrono de logging
+ * @return 0 si éxito, -1 si error
+ *
+ * Los productores encolan registros preformateados en un ring buffer
+ * MPSC sin bloqueos y un hilo dedicado realiza la E/S a consola y
+ * archivo. El costo en el hot path se reduce al formateo más una
+ * escritura en el buffer; si el ring se llena, los mensajes se
+ * descartan (contados) en lugar de bloquear la medición.
+ */
+int logger_async_start(void);
+
+/**
+ * @brief Detiene el backend asíncrono drenando los mensajes pendientes
+ */
+void logger_async_stop(void);
+
+/**
+ * @brief Espera a que el backend asíncrono drene los mensajes encolados
+ *
+ * Sin efecto si el backend asíncrono no está activo.
+ */
+void logger_flush(void);
+
 /**
  * @brief Establece el nivel mínimo de log
  * @param level Nuevo nivel mínimo
@@ -0,0 +1,311 @@
+/**
+ * @file memory_profiler.c
+ * @brief Per-call stack and heap footprint profiling implementation
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <limits.h>
+#include <pthread.h>
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <malloc.h>
+#endif
+
+#include "memory_profiler.h"
+#include "logger.h"
+#include "../core/error_codes.h"
+
+// ============================================================================
+// Constants
+// ============================================================================
+
+/// Byte pattern written over the dedicated stack before the profiled call.
+/// Chosen to be unlikely as both machine code fill and zeroed-buffer content.
+#define PQC_STACK_FILL_BYTE 0xA5
+
+/// Scratch pool that serves allocations made while dlsym() is still
+/// resolving the real allocator (dlsym itself may call calloc).
+#define PQC_BOOTSTRAP_POOL_SIZE 4096
+
+// ============================================================================
+// Heap Accounting State
+// ============================================================================
+
+#if defined(__GLIBC__)
+
+static void *(*real_malloc)(size_t) = NULL;
+static void *(*real_calloc)(size_t, size_t) = NULL;
+static void *(*real_realloc)(void *, size_t) = NULL;
+static void (*real_free)(void *) = NULL;
+
+static unsigned char bootstrap_pool[PQC_BOOTSTRAP_POOL_SIZE];
+static size_t bootstrap_used = 0;
+
+/// Live bytes can dip below the reset baseline when the profiled call frees
+/// memory allocated before the reset, so the counter is signed.
+static _Atomic int64_t heap_live_bytes = 0;
+static _Atomic int64_t heap_peak_bytes = 0;
+static _Atomic uint64_t heap_alloc_count = 0;
+
+static int pointer_in_bootstrap_pool(const void *ptr) {
+    const unsigned char *p = (const unsigned char *)ptr;
+    return p >= bootstrap_pool && p < bootstrap_pool + PQC_BOOTSTRAP_POOL_SIZE;
+}
+
+static void *bootstrap_alloc(size_t size) {
+    // Only reachable single-threaded, during the first dlsym() resolution
+    size_t aligned = (size + 15u) & ~(size_t)15u;
+    if (bootstrap_used + aligned > PQC_BOOTSTRAP_POOL_SIZE) {
+        return NULL;
+    }
+    void *p = bootstrap_pool + bootstrap_used;
+    bootstrap_used += aligned;
+    return p;
+}
+
+static void resolve_real_allocator(void) {
+    real_malloc = (void *(*)(size_t))dlsym(RTLD_NEXT, "malloc");
+    real_calloc = (void *(*)(size_t, size_t))dlsym(RTLD_NEXT, "calloc");
+    real_realloc = (void *(*)(void *, size_t))dlsym(RTLD_NEXT, "realloc");
+    real_free = (void (*)(void *))dlsym(RTLD_NEXT, "free");
+}
+
+static void heap_account_alloc(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    int64_t size = (int64_t)malloc_usable_size(ptr);
+    int64_t live = atomic_fetch_add(&heap_live_bytes, size) + size;
+    atomic_fetch_add(&heap_alloc_count, 1);
+
+    int64_t peak = atomic_load(&heap_peak_bytes);
+    while (live > peak &&
+           !atomic_compare_exchange_weak(&heap_peak_bytes, &peak, live)) {
+        // peak reloaded by the failed CAS; retry until we are not the max
+    }
+}
+
+static void heap_account_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    int64_t size = (int64_t)malloc_usable_size(ptr);
+    atomic_fetch_sub(&heap_live_bytes, size);
+}
+
+// ============================================================================
+// Allocator Interposition (glibc)
+// ============================================================================
+
+void *malloc(size_t size) {
+    if (real_malloc == NULL) {
+        resolve_real_allocator();
+        if (real_malloc == NULL) {
+            return bootstrap_alloc(size);
+        }
+    }
+    void *ptr = real_malloc(size);
+    heap_account_alloc(ptr);
+    return ptr;
+}
+
+void *calloc(size_t nmemb, size_t size) {
+    if (real_calloc == NULL) {
+        // dlsym() calls calloc while we resolve it: serve from the pool
+        // (already zeroed, it lives in .bss)
+        if (nmemb != 0 && size > SIZE_MAX / nmemb) {
+            return NULL;
+        }
+        return bootstrap_alloc(nmemb * size);
+    }
+    void *ptr = real_calloc(nmemb, size);
+    heap_account_alloc(ptr);
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size) {
+    if (real_realloc == NULL) {
+        resolve_real_allocator();
+    }
+    if (pointer_in_bootstrap_pool(ptr)) {
+        // Grown bootstrap blocks migrate to the real heap
+        void *fresh = malloc(size);
+        if (fresh != NULL && ptr != NULL) {
+            memcpy(fresh, ptr, size);
+        }
+        return fresh;
+    }
+    heap_account_free(ptr);
+    void *out = real_realloc(ptr, size);
+    if (out != NULL) {
+        heap_account_alloc(out);
+    } else if (ptr != NULL && size != 0) {
+        // Failed grow: the original block is still live
+        heap_account_alloc(ptr);
+    }
+    return out;
+}
+
+void free(void *ptr) {
+    if (ptr == NULL || pointer_in_bootstrap_pool(ptr)) {
+        return;
+    }
+    if (real_free == NULL) {
+        resolve_real_allocator();
+        if (real_free == NULL) {
+            return;
+        }
+    }
+    heap_account_free(ptr);
+    real_free(ptr);
+}
+
+// ============================================================================
+// Heap Accounting API (glibc)
+// ============================================================================
+
+void pqc_memory_heap_reset(void) {
+    atomic_store(&heap_live_bytes, 0);
+    atomic_store(&heap_peak_bytes, 0);
+    atomic_store(&heap_alloc_count, 0);
+}
+
+size_t pqc_memory_heap_peak(void) {
+    int64_t peak = atomic_load(&heap_peak_bytes);
+    return peak > 0 ? (size_t)peak : 0;
+}
+
+size_t pqc_memory_heap_alloc_count(void) {
+    return (size_t)atomic_load(&heap_alloc_count);
+}
+
+int pqc_memory_heap_tracking_available(void) {
+    return 1;
+}
+
+#else // !__GLIBC__
+
+// ============================================================================
+// Heap Accounting API (unsupported libc)
+// ============================================================================
+
+void pqc_memory_heap_reset(void) {
+    static int warned = 0;
+    if (!warned) {
+        LOG_WARN("Heap accounting requires glibc; heap figures will be zero");
+        warned = 1;
+    }
+}
+
+size_t pqc_memory_heap_peak(void) {
+    return 0;
+}
+
+size_t pqc_memory_heap_alloc_count(void) {
+    return 0;
+}
+
+int pqc_memory_heap_tracking_available(void) {
+    return 0;
+}
+
+#endif // __GLIBC__
+
+// ============================================================================
+// Profiled Call
+// ============================================================================
+
+typedef struct {
+    int (*fn)(void *arg);          ///< Call under measurement
+    void *arg;                     ///< Opaque argument for fn
+    int ret;                       ///< fn's return value
+    size_t heap_peak_bytes;        ///< Sampled right after fn returns
+    size_t heap_alloc_count;       ///< Sampled right after fn returns
+} profile_thread_args_t;
+
+static void *profile_thread_main(void *p) {
+    profile_thread_args_t *args = (profile_thread_args_t *)p;
+
+    // Reset here, not in the parent, so pthread_create's own bookkeeping
+    // allocations stay out of the heap figures
+    pqc_memory_heap_reset();
+    args->ret = args->fn(args->arg);
+    args->heap_peak_bytes = pqc_memory_heap_peak();
+    args->heap_alloc_count = pqc_memory_heap_alloc_count();
+
+    return NULL;
+}
+
+int pqc_memory_profile_call(int (*fn)(void *arg), void *arg,
+                            size_t stack_size, pqc_memory_profile_t *out) {
+    if (fn == NULL || out == NULL) {
+        LOG_ERROR("NULL parameter in pqc_memory_profile_call");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    stack_size = (stack_size + page_size - 1) & ~(page_size - 1);
+#ifdef PTHREAD_STACK_MIN
+    if (stack_size < (size_t)PTHREAD_STACK_MIN) {
+        LOG_ERROR("Stack size %zu below PTHREAD_STACK_MIN", stack_size);
+        return PQC_ERROR_INVALID_PARAM;
+    }
+#endif
+
+    memset(out, 0, sizeof(*out));
+    out->stack_size_bytes = stack_size;
+
+    unsigned char *stack = NULL;
+    if (posix_memalign((void **)&stack, page_size, stack_size) != 0) {
+        LOG_ERROR("Failed to allocate %zu byte profiling stack", stack_size);
+        return PQC_ERROR_MEMORY_ALLOC;
+    }
+    memset(stack, PQC_STACK_FILL_BYTE, stack_size);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstack(&attr, stack, stack_size) != 0) {
+        LOG_ERROR("pthread_attr_setstack failed (size %zu)", stack_size);
+        pthread_attr_destroy(&attr);
+        free(stack);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+
+    profile_thread_args_t args = { fn, arg, PQC_ERROR_OPERATION_FAILED, 0, 0 };
+    pthread_t thread;
+    int rc = pthread_create(&thread, &attr, profile_thread_main, &args);
+    pthread_attr_destroy(&attr);
+    if (rc != 0) {
+        LOG_ERROR("Failed to create profiling thread: %s", strerror(rc));
+        free(stack);
+        return PQC_ERROR_OPERATION_FAILED;
+    }
+    pthread_join(thread, NULL);
+
+    // The stack grows downward: the first byte (from the bottom) that no
+    // longer holds the fill pattern marks the deepest frame
+    size_t first_touched = stack_size;
+    for (size_t i = 0; i < stack_size; i++) {
+        if (stack[i] != PQC_STACK_FILL_BYTE) {
+            first_touched = i;
+            break;
+        }
+    }
+    out->stack_peak_bytes = stack_size - first_touched;
+    out->heap_peak_bytes = args.heap_peak_bytes;
+    out->heap_alloc_count = args.heap_alloc_count;
+    free(stack);
+
+    return args.ret;
+}
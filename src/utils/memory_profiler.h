@@ -0,0 +1,100 @@
+/**
+ * @file memory_profiler.h
+ * @brief Per-call stack and heap footprint profiling
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Measures the transient memory footprint of a single cryptographic call:
+ *
+ * - Peak stack usage: the call runs on a dedicated thread whose stack is
+ *   pre-filled with a known byte pattern. After the thread exits, the stack
+ *   is scanned from its low address for the first overwritten byte; the
+ *   distance from there to the top of the stack is the high-water mark.
+ *
+ * - Heap high-water mark: this translation unit interposes malloc/calloc/
+ *   realloc/free and tracks the live allocation total. Interposition is
+ *   link-time: only binaries that link memory_profiler.o are affected, the
+ *   benchmark engine and the other tools are untouched.
+ *
+ * Heap accounting requires glibc (malloc_usable_size); on other C libraries
+ * the heap counters stay at zero and a warning is logged once.
+ *
+ * The stack figure is conservative: it includes the thread's TLS block and
+ * guard-adjacent bookkeeping that glibc places at the top of an application-
+ * supplied stack (a few KB, constant per libc version). Comparisons between
+ * algorithms on the same machine are unaffected.
+ */
+
+#ifndef MEMORY_PROFILER_H
+#define MEMORY_PROFILER_H
+
+#include <stddef.h>
+
+// ============================================================================
+// Types
+// ============================================================================
+
+/**
+ * @brief Memory footprint of one profiled call
+ */
+typedef struct {
+    size_t stack_peak_bytes;   ///< Stack high-water mark (pattern scan)
+    size_t heap_peak_bytes;    ///< Peak live heap during the call
+    size_t heap_alloc_count;   ///< Number of allocations during the call
+    size_t stack_size_bytes;   ///< Stack size the call ran with
+} pqc_memory_profile_t;
+
+// ============================================================================
+// Heap Accounting
+// ============================================================================
+
+/**
+ * @brief Reset the live/peak heap counters to the current moment
+ *
+ * Subsequent allocations are tracked against a zero baseline; frees of
+ * allocations made before the reset do not drive the counters negative.
+ */
+void pqc_memory_heap_reset(void);
+
+/**
+ * @brief Peak live heap in bytes since the last pqc_memory_heap_reset()
+ */
+size_t pqc_memory_heap_peak(void);
+
+/**
+ * @brief Number of allocations since the last pqc_memory_heap_reset()
+ */
+size_t pqc_memory_heap_alloc_count(void);
+
+/**
+ * @brief Whether heap accounting is available on this C library
+ * @return 1 if malloc interposition is active, 0 otherwise
+ */
+int pqc_memory_heap_tracking_available(void);
+
+// ============================================================================
+// Profiled Call
+// ============================================================================
+
+/**
+ * @brief Run fn(arg) on a pattern-filled dedicated stack and measure footprint
+ * @param fn Function to profile (same shape as the engine's benchmark_op_fn)
+ * @param arg Opaque argument passed through to fn
+ * @param stack_size Stack size for the profiled thread, in bytes
+ *                   (rounded up to the page size; must be at least
+ *                   PTHREAD_STACK_MIN)
+ * @param out Output: footprint of the call (must not be NULL)
+ * @return fn's return value, or PQC_ERROR_* if the thread could not be set up
+ *
+ * Heap counters are reset inside the profiled thread immediately before fn
+ * runs and sampled immediately after it returns, so pthread bookkeeping
+ * allocations are excluded from the heap figures.
+ *
+ * If fn overflows the supplied stack the process crashes (there is a guard
+ * page below the stack); pick a generous size and shrink it to answer
+ * "does this fit" questions.
+ */
+int pqc_memory_profile_call(int (*fn)(void *arg), void *arg,
+                            size_t stack_size, pqc_memory_profile_t *out);
+
+#endif // MEMORY_PROFILER_H
@@ -0,0 +1,230 @@
+/**
+ * @file perf_counters.c
+ * @brief Implementation of perf_event_open counter instrumentation
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ */
+
+#include "perf_counters.h"
+#include "logger.h"
+#include "../core/error_codes.h"
+#include <string.h>
+#include <errno.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+/**
+ * @brief perf_event_open has no glibc wrapper; call it directly
+ */
+static int perf_event_open(struct perf_event_attr *attr, pid_t pid, int cpu,
+                           int group_fd, unsigned long flags) {
+    return (int)syscall(SYS_perf_event_open, attr, pid, cpu, group_fd, flags);
+}
+
+/**
+ * @brief perf event type/config pair for each sampled event
+ */
+static void event_attr_config(pqc_perf_event_t event, uint32_t *type,
+                              uint64_t *config) {
+    switch (event) {
+        case PQC_PERF_CYCLES:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PQC_PERF_INSTRUCTIONS:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PQC_PERF_L1D_MISSES:
+            *type = PERF_TYPE_HW_CACHE;
+            *config = PERF_COUNT_HW_CACHE_L1D |
+                      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case PQC_PERF_LLC_MISSES:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case PQC_PERF_BRANCH_MISSES:
+        default:
+            *type = PERF_TYPE_HARDWARE;
+            *config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+    }
+}
+
+// ============================================================================
+// Performance Counter Functions
+// ============================================================================
+
+int pqc_perf_open(pqc_perf_group_t *group) {
+    if (group == NULL) {
+        LOG_ERROR("NULL group in perf_open");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    group->available = 0;
+
+    for (int i = 0; i < PQC_PERF_EVENT_COUNT; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        uint32_t type;
+        uint64_t config;
+        event_attr_config((pqc_perf_event_t)i, &type, &config);
+        attr.type = type;
+        attr.config = config;
+
+        // Per-thread counting on any CPU; each event stands alone so a
+        // missing counter does not take the others down
+        group->fds[i] = perf_event_open(&attr, 0, -1, -1, 0);
+
+        if (group->fds[i] < 0) {
+            LOG_DEBUG("perf event %s unavailable: %s",
+                      pqc_perf_event_string((pqc_perf_event_t)i),
+                      strerror(errno));
+        } else {
+            group->available++;
+        }
+    }
+
+    if (group->available == 0) {
+        LOG_WARN("No hardware performance counters available "
+                 "(no PMU or perf_event_paranoid too strict)");
+        return PQC_ERROR_NOT_SUPPORTED;
+    }
+
+    LOG_DEBUG("Opened %d/%d hardware performance counters",
+              group->available, PQC_PERF_EVENT_COUNT);
+
+    return PQC_SUCCESS;
+}
+
+void pqc_perf_start(pqc_perf_group_t *group) {
+    if (group == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < PQC_PERF_EVENT_COUNT; i++) {
+        if (group->fds[i] >= 0) {
+            ioctl(group->fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(group->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void pqc_perf_stop(pqc_perf_group_t *group) {
+    if (group == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < PQC_PERF_EVENT_COUNT; i++) {
+        if (group->fds[i] >= 0) {
+            ioctl(group->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+}
+
+int pqc_perf_read(pqc_perf_group_t *group, pqc_perf_counts_t *counts) {
+    if (group == NULL || counts == NULL) {
+        LOG_ERROR("NULL parameter in perf_read");
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    memset(counts, 0, sizeof(*counts));
+
+    for (int i = 0; i < PQC_PERF_EVENT_COUNT; i++) {
+        if (group->fds[i] < 0) {
+            continue;
+        }
+
+        uint64_t value = 0;
+        if (read(group->fds[i], &value, sizeof(value)) == sizeof(value)) {
+            counts->value[i] = value;
+            counts->valid[i] = true;
+        } else {
+            LOG_WARN("Failed to read perf event %s: %s",
+                     pqc_perf_event_string((pqc_perf_event_t)i),
+                     strerror(errno));
+        }
+    }
+
+    return PQC_SUCCESS;
+}
+
+void pqc_perf_close(pqc_perf_group_t *group) {
+    if (group == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < PQC_PERF_EVENT_COUNT; i++) {
+        if (group->fds[i] >= 0) {
+            close(group->fds[i]);
+            group->fds[i] = -1;
+        }
+    }
+
+    group->available = 0;
+}
+
+#else  // !__linux__
+
+int pqc_perf_open(pqc_perf_group_t *group) {
+    if (group == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+
+    for (int i = 0; i < PQC_PERF_EVENT_COUNT; i++) {
+        group->fds[i] = -1;
+    }
+    group->available = 0;
+
+    LOG_WARN("perf_event counters are only available on Linux");
+
+    return PQC_ERROR_NOT_SUPPORTED;
+}
+
+void pqc_perf_start(pqc_perf_group_t *group) { (void)group; }
+
+void pqc_perf_stop(pqc_perf_group_t *group) { (void)group; }
+
+int pqc_perf_read(pqc_perf_group_t *group, pqc_perf_counts_t *counts) {
+    (void)group;
+    if (counts != NULL) {
+        memset(counts, 0, sizeof(*counts));
+    }
+    return PQC_ERROR_NOT_SUPPORTED;
+}
+
+void pqc_perf_close(pqc_perf_group_t *group) { (void)group; }
+
+#endif  // __linux__
+
+const char* pqc_perf_event_string(pqc_perf_event_t event) {
+    switch (event) {
+        case PQC_PERF_CYCLES:
+            return "cycles";
+        case PQC_PERF_INSTRUCTIONS:
+            return "instructions";
+        case PQC_PERF_L1D_MISSES:
+            return "l1d_misses";
+        case PQC_PERF_LLC_MISSES:
+            return "llc_misses";
+        case PQC_PERF_BRANCH_MISSES:
+            return "branch_misses";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file perf_counters.h
+ * @brief Hardware performance-counter instrumentation via perf_event_open
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Wraps the Linux perf_event interface to sample cycles, instructions,
+ * L1d/LLC misses and branch mispredictions around a measured region.
+ * Every event is optional: kernels or cores without a PMU (e.g. our
+ * riscv64 boards under QEMU) simply report the event as unavailable and
+ * benchmarks continue timing-only.
+ */
+
+#ifndef PQC_PERF_COUNTERS_H
+#define PQC_PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ============================================================================
+// Data Types
+// ============================================================================
+
+/**
+ * @brief Hardware events sampled around the measured region
+ */
+typedef enum {
+    PQC_PERF_CYCLES,           ///< CPU cycles
+    PQC_PERF_INSTRUCTIONS,     ///< Retired instructions
+    PQC_PERF_L1D_MISSES,       ///< L1 data cache read misses
+    PQC_PERF_LLC_MISSES,       ///< Last-level cache misses
+    PQC_PERF_BRANCH_MISSES,    ///< Branch mispredictions
+    PQC_PERF_EVENT_COUNT       ///< Number of events (array size)
+} pqc_perf_event_t;
+
+/**
+ * @brief An open set of per-event perf file descriptors
+ *
+ * Events that failed to open have fd -1 and are skipped by start/stop/
+ * read; available counts how many opened successfully.
+ */
+typedef struct {
+    int fds[PQC_PERF_EVENT_COUNT];   ///< One fd per event, -1 if unavailable
+    int available;                   ///< Events that opened successfully
+} pqc_perf_group_t;
+
+/**
+ * @brief Counter values read from an event group
+ */
+typedef struct {
+    uint64_t value[PQC_PERF_EVENT_COUNT];  ///< Raw counts (0 if invalid)
+    bool valid[PQC_PERF_EVENT_COUNT];      ///< Whether each count was read
+} pqc_perf_counts_t;
+
+// ============================================================================
+// Performance Counter Functions
+// ============================================================================
+
+/**
+ * @brief Open the hardware event set for the calling thread
+ * @param group Group to initialize
+ * @return 0 if at least one event opened, negative error code otherwise
+ *
+ * Counters start disabled; bracket the measured region with
+ * pqc_perf_start()/pqc_perf_stop(). Returns PQC_ERROR_NOT_SUPPORTED when
+ * no event could be opened (no PMU, or perf_event_paranoid too strict),
+ * which callers should treat as "continue timing-only".
+ */
+int pqc_perf_open(pqc_perf_group_t *group);
+
+/**
+ * @brief Reset and enable all available counters
+ * @param group Open event group
+ */
+void pqc_perf_start(pqc_perf_group_t *group);
+
+/**
+ * @brief Disable all available counters
+ * @param group Open event group
+ */
+void pqc_perf_stop(pqc_perf_group_t *group);
+
+/**
+ * @brief Read current counter values
+ * @param group Open event group
+ * @param counts Output: per-event values and validity flags
+ * @return 0 on success, negative error code on failure
+ */
+int pqc_perf_read(pqc_perf_group_t *group, pqc_perf_counts_t *counts);
+
+/**
+ * @brief Close all event file descriptors (safe on a zeroed group)
+ * @param group Group to close
+ */
+void pqc_perf_close(pqc_perf_group_t *group);
+
+/**
+ * @brief Human-readable event name
+ * @param event Event to describe
+ * @return Static string
+ */
+const char* pqc_perf_event_string(pqc_perf_event_t event);
+
+#endif // PQC_PERF_COUNTERS_H
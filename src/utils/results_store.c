@@ -0,0 +1,245 @@
+/**
+ * @file results_store.c
+ * @brief Indexed append-only results store implementation
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Append ordering keeps a half-written append harmless: the record body
+ * goes to the end of the file first, then the bucket slot is pointed at
+ * it, then the header record count is bumped. A crash between those steps
+ * leaves an unreachable tail record, never a broken chain.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "results_store.h"
+#include "logger.h"
+#include "../core/error_codes.h"
+
+// ============================================================================
+// Bucket Hash
+// ============================================================================
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME        0x100000001b3ULL
+
+static uint64_t fnv1a_append(uint64_t hash, const char *s) {
+    for (; *s != '\0'; s++) {
+        hash ^= (uint64_t)(unsigned char)*s;
+        hash *= FNV_PRIME;
+    }
+    // NUL separator keeps ("ab","c") distinct from ("a","bc")
+    hash ^= 0;
+    hash *= FNV_PRIME;
+    return hash;
+}
+
+uint32_t pqc_store_bucket(const char *algorithm, const char *operation,
+                          const char *architecture, uint32_t num_buckets) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    hash = fnv1a_append(hash, algorithm);
+    hash = fnv1a_append(hash, operation);
+    hash = fnv1a_append(hash, architecture);
+    return (uint32_t)(hash % num_buckets);
+}
+
+// ============================================================================
+// Header I/O
+// ============================================================================
+
+static long bucket_slot_offset(uint32_t bucket) {
+    return (long)(sizeof(pqc_store_header_t) + (size_t)bucket * sizeof(uint64_t));
+}
+
+static int write_header(pqc_results_store_t *store) {
+    if (fseek(store->fp, 0, SEEK_SET) != 0 ||
+        fwrite(&store->header, sizeof(store->header), 1, store->fp) != 1) {
+        return PQC_ERROR_IO;
+    }
+    return PQC_SUCCESS;
+}
+
+static int format_store(pqc_results_store_t *store) {
+    memcpy(store->header.magic, PQC_STORE_FILE_MAGIC,
+           sizeof(store->header.magic));
+    store->header.header_size = (uint32_t)(sizeof(pqc_store_header_t) +
+        PQC_STORE_NUM_BUCKETS * sizeof(uint64_t));
+    store->header.record_size = (uint32_t)sizeof(pqc_store_record_t);
+    store->header.num_buckets = PQC_STORE_NUM_BUCKETS;
+    store->header.reserved = 0;
+    store->header.num_records = 0;
+
+    if (write_header(store) != PQC_SUCCESS) {
+        return PQC_ERROR_IO;
+    }
+
+    uint64_t empty = 0;
+    for (uint32_t i = 0; i < store->header.num_buckets; i++) {
+        if (fwrite(&empty, sizeof(empty), 1, store->fp) != 1) {
+            return PQC_ERROR_IO;
+        }
+    }
+    return (fflush(store->fp) == 0) ? PQC_SUCCESS : PQC_ERROR_IO;
+}
+
+// ============================================================================
+// Store Functions
+// ============================================================================
+
+int pqc_results_store_open(pqc_results_store_t *store, const char *path) {
+    if (store == NULL || path == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+    memset(store, 0, sizeof(*store));
+
+    // "r+b" keeps an existing store; fall back to "w+b" to create one
+    store->fp = fopen(path, "r+b");
+    if (store->fp == NULL) {
+        store->fp = fopen(path, "w+b");
+        if (store->fp == NULL) {
+            LOG_ERROR("Failed to open results store %s", path);
+            return PQC_ERROR_IO;
+        }
+        int ret = format_store(store);
+        if (ret != PQC_SUCCESS) {
+            LOG_ERROR("Failed to format results store %s", path);
+            fclose(store->fp);
+            store->fp = NULL;
+            return ret;
+        }
+        LOG_INFO("Created results store %s (%u buckets)", path,
+                 store->header.num_buckets);
+        return PQC_SUCCESS;
+    }
+
+    if (fread(&store->header, sizeof(store->header), 1, store->fp) != 1) {
+        // Zero-length file from an interrupted creation: reformat in place
+        if (fseek(store->fp, 0, SEEK_END) == 0 && ftell(store->fp) == 0) {
+            return format_store(store);
+        }
+        LOG_ERROR("Results store %s: truncated header", path);
+        fclose(store->fp);
+        store->fp = NULL;
+        return PQC_ERROR_IO;
+    }
+
+    if (memcmp(store->header.magic, PQC_STORE_FILE_MAGIC,
+               sizeof(store->header.magic)) != 0 ||
+        store->header.record_size != sizeof(pqc_store_record_t)) {
+        LOG_ERROR("Results store %s: incompatible format", path);
+        fclose(store->fp);
+        store->fp = NULL;
+        return PQC_ERROR_INVALID_STATE;
+    }
+    return PQC_SUCCESS;
+}
+
+/**
+ * @brief Copy a name into a fixed field, always NUL-terminated
+ */
+static void copy_name(char *dst, size_t dst_len, const char *src) {
+    memset(dst, 0, dst_len);
+    if (src != NULL) {
+        strncpy(dst, src, dst_len - 1);
+    }
+}
+
+static uint32_t result_flags(const BenchmarkResult *r) {
+    uint32_t flags = 0;
+    if (r->cold_cache)     flags |= PQC_STORE_FLAG_COLD_CACHE;
+    if (r->freq_throttled) flags |= PQC_STORE_FLAG_THROTTLED;
+    if (r->regressed)      flags |= PQC_STORE_FLAG_REGRESSED;
+    return flags;
+}
+
+int pqc_results_store_append(pqc_results_store_t *store,
+                             const BenchmarkResultSet *result_set,
+                             uint64_t timestamp) {
+    if (store == NULL || store->fp == NULL || result_set == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+    if (timestamp == 0) {
+        timestamp = (uint64_t)time(NULL);
+    }
+
+    for (int i = 0; i < result_set->num_results; i++) {
+        const BenchmarkResult *r = &result_set->results[i];
+
+        pqc_store_record_t record;
+        memset(&record, 0, sizeof(record));
+        record.timestamp = timestamp;
+        copy_name(record.algorithm, sizeof(record.algorithm), r->algorithm);
+        copy_name(record.operation, sizeof(record.operation), r->operation);
+        copy_name(record.architecture, sizeof(record.architecture),
+                  r->architecture);
+        record.num_samples       = (uint32_t)r->num_samples;
+        record.warmup_iterations = (uint32_t)r->warmup_iterations_used;
+        record.flags             = result_flags(r);
+        record.batch_size        = (uint32_t)r->batch_size;
+        record.mean              = r->mean;
+        record.median            = r->median;
+        record.std_dev           = r->std_dev;
+        record.min               = r->min;
+        record.max               = r->max;
+        record.p95               = r->p95;
+        record.p99               = r->p99;
+        record.p999              = r->p999;
+        record.throughput_ops_sec = r->throughput_ops_sec;
+        record.amortized_ns_op   = r->amortized_ns_op;
+
+        uint32_t bucket = pqc_store_bucket(record.algorithm, record.operation,
+                                           record.architecture,
+                                           store->header.num_buckets);
+
+        // Link the new record in front of the current chain head
+        uint64_t head = 0;
+        if (fseek(store->fp, bucket_slot_offset(bucket), SEEK_SET) != 0 ||
+            fread(&head, sizeof(head), 1, store->fp) != 1) {
+            return PQC_ERROR_IO;
+        }
+        record.prev_offset = head;
+
+        if (fseek(store->fp, 0, SEEK_END) != 0) {
+            return PQC_ERROR_IO;
+        }
+        uint64_t offset = (uint64_t)ftell(store->fp);
+        if (fwrite(&record, sizeof(record), 1, store->fp) != 1) {
+            return PQC_ERROR_IO;
+        }
+
+        if (fseek(store->fp, bucket_slot_offset(bucket), SEEK_SET) != 0 ||
+            fwrite(&offset, sizeof(offset), 1, store->fp) != 1) {
+            return PQC_ERROR_IO;
+        }
+        store->header.num_records++;
+    }
+
+    int ret = write_header(store);
+    if (ret != PQC_SUCCESS) {
+        return ret;
+    }
+    if (fflush(store->fp) != 0) {
+        return PQC_ERROR_IO;
+    }
+
+    LOG_DEBUG("Appended %d records to results store (total %llu)",
+              result_set->num_results,
+              (unsigned long long)store->header.num_records);
+    return PQC_SUCCESS;
+}
+
+int pqc_results_store_close(pqc_results_store_t *store) {
+    if (store == NULL) {
+        return PQC_ERROR_NULL_POINTER;
+    }
+    if (store->fp != NULL) {
+        if (fclose(store->fp) != 0) {
+            store->fp = NULL;
+            return PQC_ERROR_IO;
+        }
+        store->fp = NULL;
+    }
+    return PQC_SUCCESS;
+}
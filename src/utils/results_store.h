@@ -0,0 +1,158 @@
+/**
+ * @file results_store.h
+ * @brief Indexed append-only store for consolidated benchmark results
+ * @author Benchmarks-PQC Team
+ * @date 2026-08-29
+ *
+ * Months of nightly campaigns leave results/ full of small per-run JSON
+ * files that the Python analysis layer re-parses in full on every
+ * invocation. This module consolidates runs into a single binary file of
+ * fixed-size records, indexed in-file by (algorithm, operation,
+ * architecture): a hash bucket table after the header holds the offset of
+ * the newest record for each series, and every record stores the offset
+ * of the previous record in its chain. A trend query walks one chain
+ * newest-first and stops at its time horizon without touching the rest of
+ * the file.
+ *
+ * The companion reader/importer is src/analysis/results_store.py; both
+ * sides must agree on the record layout and the bucket hash below.
+ */
+
+#ifndef RESULTS_STORE_H
+#define RESULTS_STORE_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../core/benchmark_engine.h"
+
+// ============================================================================
+// On-disk Format
+// ============================================================================
+
+/**
+ * @brief File magic identifying a results store (not NUL-terminated)
+ */
+#define PQC_STORE_FILE_MAGIC "PQCSTOR1"
+
+/**
+ * @brief Number of index buckets (fixed at creation, stored in the header)
+ */
+#define PQC_STORE_NUM_BUCKETS 1024
+
+/**
+ * @brief On-disk header of a results store file
+ *
+ * The header is followed by num_buckets little-endian uint64_t bucket
+ * slots, each the absolute file offset of the newest record whose series
+ * key hashes into that bucket (0 = empty). Records start at header_size.
+ * Appends are crash-tolerant in the weak sense: a record written without
+ * its bucket update is unreachable and harmless, never corrupt.
+ */
+typedef struct {
+    char     magic[8];         ///< PQC_STORE_FILE_MAGIC
+    uint32_t header_size;      ///< Byte offset of the first record
+    uint32_t record_size;      ///< Bytes per record (sizeof(pqc_store_record_t))
+    uint32_t num_buckets;      ///< Index bucket count
+    uint32_t reserved;         ///< Zero, reserved for format evolution
+    uint64_t num_records;      ///< Records currently reachable via the index
+} pqc_store_header_t;
+
+/**
+ * @brief One benchmark result as stored on disk
+ *
+ * Scalar statistics only; raw sample columns stay in their binary dumps.
+ * prev_offset chains records that share a bucket, newest-first, so chains
+ * are reverse-chronological and a bounded-horizon query can stop early.
+ * Layout must match _RECORD_FORMAT in src/analysis/results_store.py.
+ */
+typedef struct {
+    uint64_t prev_offset;      ///< Previous record in this bucket's chain (0 = end)
+    uint64_t timestamp;        ///< Unix seconds when the record was appended
+    char     algorithm[32];    ///< NUL-terminated algorithm name
+    char     operation[16];    ///< NUL-terminated operation name
+    char     architecture[16]; ///< NUL-terminated architecture name
+    uint32_t num_samples;      ///< Number of timing samples behind the stats
+    uint32_t warmup_iterations;///< Warmup iterations run before sampling
+    uint32_t flags;            ///< PQC_STORE_FLAG_* bits
+    uint32_t batch_size;       ///< Operations per timed batch (1 = latency mode)
+    double   mean;             ///< Mean time in microseconds
+    double   median;           ///< Median time in microseconds
+    double   std_dev;          ///< Standard deviation in microseconds
+    double   min;              ///< Minimum time in microseconds
+    double   max;              ///< Maximum time in microseconds
+    double   p95;              ///< 95th percentile in microseconds
+    double   p99;              ///< 99th percentile in microseconds
+    double   p999;             ///< 99.9th percentile in microseconds
+    double   throughput_ops_sec; ///< Sustained operations per second
+    double   amortized_ns_op;  ///< Amortized nanoseconds per operation
+} pqc_store_record_t;
+
+#define PQC_STORE_FLAG_COLD_CACHE  0x1u  ///< Samples taken with cache eviction
+#define PQC_STORE_FLAG_THROTTLED   0x2u  ///< Frequency throttling was detected
+#define PQC_STORE_FLAG_REGRESSED   0x4u  ///< Failed the baseline regression gate
+
+// ============================================================================
+// Store Handle
+// ============================================================================
+
+/**
+ * @brief An open results store (single writer; readers use the Python side)
+ */
+typedef struct {
+    FILE *fp;                  ///< Store file opened read/write
+    pqc_store_header_t header; ///< In-memory copy of the file header
+} pqc_results_store_t;
+
+// ============================================================================
+// Store Functions
+// ============================================================================
+
+/**
+ * @brief Open a results store, creating and formatting it if absent
+ * @param store Store handle to initialize
+ * @param path Store file path
+ * @return PQC_SUCCESS or negative error code
+ *
+ * An existing file is validated against the magic and record size so a
+ * writer built after a format change refuses an old store instead of
+ * interleaving incompatible records.
+ */
+int pqc_results_store_open(pqc_results_store_t *store, const char *path);
+
+/**
+ * @brief Append every result in a set to the store
+ * @param store Open store handle
+ * @param result_set Results to append
+ * @param timestamp Unix seconds to stamp the records with (0 = now)
+ * @return PQC_SUCCESS or negative error code
+ *
+ * Each result becomes one record linked into its series chain; the
+ * header and bucket updates are flushed before returning.
+ */
+int pqc_results_store_append(pqc_results_store_t *store,
+                             const BenchmarkResultSet *result_set,
+                             uint64_t timestamp);
+
+/**
+ * @brief Flush and close a store handle
+ * @param store Store to close (safe on a never-opened zeroed handle)
+ * @return PQC_SUCCESS or negative error code
+ */
+int pqc_results_store_close(pqc_results_store_t *store);
+
+/**
+ * @brief Hash a series key to its bucket index
+ * @param algorithm Algorithm name
+ * @param operation Operation name
+ * @param architecture Architecture name
+ * @param num_buckets Bucket count from the store header
+ * @return Bucket index in [0, num_buckets)
+ *
+ * FNV-1a over the three names with NUL separators; the Python reader
+ * implements the same function to locate chains without scanning.
+ */
+uint32_t pqc_store_bucket(const char *algorithm, const char *operation,
+                          const char *architecture, uint32_t num_buckets);
+
+#endif // RESULTS_STORE_H
@@ -12,6 +12,12 @@
 #include <string.h>
 #include <stdlib.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 // ============================================================================
 // Helper Functions
 // ============================================================================
@@ -37,6 +43,466 @@ static void sort_array(uint64_t *data, size_t n) {
     }
 }
 
+// ============================================================================
+// Vectorized Kernels
+// ============================================================================
+
+// Above this range length Floyd-Rivest refines the pivot on a sample
+#define PQC_SELECT_SAMPLE_CUTOFF 600
+
+#if defined(__AVX2__)
+/**
+ * @brief Convert four signed 64-bit lanes to doubles (AVX2 has no cvt)
+ *
+ * Magic-constant trick: valid for |x| < 2^51, which holds for the
+ * mean-shifted timing deltas fed in here (2^51 ns is 26 days).
+ */
+static inline __m256d i64x4_to_pd(__m256i v) {
+    const __m256i magic_i = _mm256_set1_epi64x(0x4338000000000000LL);
+    const __m256d magic_d = _mm256_set1_pd(6755399441055744.0);
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(v, magic_i)),
+                         magic_d);
+}
+#endif
+
+/**
+ * @brief Fused single-pass min/max/mean/stddev over a sample array
+ *
+ * Replaces the four separate passes the summary used to take. Values are
+ * accumulated shifted by the first element so the variance terms stay
+ * small and the textbook sum-of-squares formula is numerically safe
+ * (the shift sits inside the data range, so there is no catastrophic
+ * cancellation). AVX2 and NEON paths process 4 and 2 lanes per step;
+ * the 64-bit compares are signed, which is fine because nanosecond
+ * timings never approach 2^63.
+ */
+static void stats_fused_pass(const uint64_t *data, size_t n,
+                             uint64_t *out_min, uint64_t *out_max,
+                             double *out_mean, double *out_stddev) {
+    const uint64_t x0 = data[0];
+    uint64_t min_val = data[0];
+    uint64_t max_val = data[0];
+    double sum = 0.0;
+    double sumsq = 0.0;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    if (n >= 8) {
+        const __m256i vx0 = _mm256_set1_epi64x((long long)x0);
+        __m256i vmin = _mm256_set1_epi64x((long long)x0);
+        __m256i vmax = vmin;
+        __m256d vsum = _mm256_setzero_pd();
+        __m256d vsumsq = _mm256_setzero_pd();
+
+        size_t vec_end = n & ~(size_t)3;
+        for (; i < vec_end; i += 4) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+
+            __m256i gt = _mm256_cmpgt_epi64(v, vmax);
+            vmax = _mm256_blendv_epi8(vmax, v, gt);
+            __m256i lt = _mm256_cmpgt_epi64(vmin, v);
+            vmin = _mm256_blendv_epi8(vmin, v, lt);
+
+            __m256d fd = i64x4_to_pd(_mm256_sub_epi64(v, vx0));
+            vsum = _mm256_add_pd(vsum, fd);
+            vsumsq = _mm256_add_pd(vsumsq, _mm256_mul_pd(fd, fd));
+        }
+
+        uint64_t lane_min[4], lane_max[4];
+        double lane_sum[4], lane_sumsq[4];
+        _mm256_storeu_si256((__m256i*)lane_min, vmin);
+        _mm256_storeu_si256((__m256i*)lane_max, vmax);
+        _mm256_storeu_pd(lane_sum, vsum);
+        _mm256_storeu_pd(lane_sumsq, vsumsq);
+        for (int lane = 0; lane < 4; lane++) {
+            if (lane_min[lane] < min_val) min_val = lane_min[lane];
+            if (lane_max[lane] > max_val) max_val = lane_max[lane];
+            sum += lane_sum[lane];
+            sumsq += lane_sumsq[lane];
+        }
+    }
+#elif defined(__aarch64__)
+    if (n >= 4) {
+        const int64x2_t vx0 = vdupq_n_s64((int64_t)x0);
+        int64x2_t vmin = vx0;
+        int64x2_t vmax = vx0;
+        float64x2_t vsum = vdupq_n_f64(0.0);
+        float64x2_t vsumsq = vdupq_n_f64(0.0);
+
+        size_t vec_end = n & ~(size_t)1;
+        for (; i < vec_end; i += 2) {
+            int64x2_t v = vld1q_s64((const int64_t*)(data + i));
+
+            vmax = vbslq_s64(vcgtq_s64(v, vmax), v, vmax);
+            vmin = vbslq_s64(vcgtq_s64(vmin, v), v, vmin);
+
+            float64x2_t fd = vcvtq_f64_s64(vsubq_s64(v, vx0));
+            vsum = vaddq_f64(vsum, fd);
+            vsumsq = vfmaq_f64(vsumsq, fd, fd);
+        }
+
+        uint64_t m;
+        m = (uint64_t)vgetq_lane_s64(vmin, 0);
+        if (m < min_val) min_val = m;
+        m = (uint64_t)vgetq_lane_s64(vmin, 1);
+        if (m < min_val) min_val = m;
+        m = (uint64_t)vgetq_lane_s64(vmax, 0);
+        if (m > max_val) max_val = m;
+        m = (uint64_t)vgetq_lane_s64(vmax, 1);
+        if (m > max_val) max_val = m;
+        sum += vgetq_lane_f64(vsum, 0) + vgetq_lane_f64(vsum, 1);
+        sumsq += vgetq_lane_f64(vsumsq, 0) + vgetq_lane_f64(vsumsq, 1);
+    }
+#endif
+
+    for (; i < n; i++) {
+        uint64_t v = data[i];
+        if (v < min_val) min_val = v;
+        if (v > max_val) max_val = v;
+        double fd = (double)((int64_t)(v - x0));
+        sum += fd;
+        sumsq += fd * fd;
+    }
+
+    *out_min = min_val;
+    *out_max = max_val;
+    *out_mean = (double)x0 + sum / (double)n;
+
+    if (n < 2) {
+        *out_stddev = 0.0;
+    } else {
+        double variance = (sumsq - sum * sum / (double)n) / (double)(n - 1);
+        *out_stddev = (variance > 0.0) ? sqrt(variance) : 0.0;
+    }
+}
+
+/**
+ * @brief Floyd-Rivest selection over the inclusive range [left, right]
+ *
+ * Before partitioning a large range, recursively selects on a small
+ * sample around k to obtain pivot bounds that almost surely bracket the
+ * k-th element, so the main pass over the data partitions against a
+ * near-perfect pivot. That brings the expected cost to about 1.5n
+ * comparisons against the 3-4n of plain quickselect. Signed indices keep
+ * the classic formulation free of unsigned-underflow edge cases.
+ */
+static void fr_select(uint64_t *d, int64_t left, int64_t right, int64_t k) {
+    while (right > left) {
+        if (right - left > PQC_SELECT_SAMPLE_CUTOFF) {
+            double n = (double)(right - left + 1);
+            double i = (double)(k - left + 1);
+            double z = log(n);
+            double s = 0.5 * exp(2.0 * z / 3.0);
+            double sd = 0.5 * sqrt(z * s * (n - s) / n) *
+                        ((i - n / 2.0 < 0.0) ? -1.0 : 1.0);
+            int64_t new_left = k - (int64_t)(i * s / n) + (int64_t)sd;
+            int64_t new_right = k + (int64_t)((n - i) * s / n) + (int64_t)sd;
+            if (new_left < left) new_left = left;
+            if (new_right > right) new_right = right;
+            fr_select(d, new_left, new_right, k);
+        }
+
+        uint64_t t = d[k];
+        int64_t i = left;
+        int64_t j = right;
+        uint64_t tmp;
+
+        tmp = d[left]; d[left] = d[k]; d[k] = tmp;
+        if (d[right] > t) {
+            tmp = d[right]; d[right] = d[left]; d[left] = tmp;
+        }
+        while (i < j) {
+            tmp = d[i]; d[i] = d[j]; d[j] = tmp;
+            i++;
+            j--;
+            while (d[i] < t) i++;
+            while (d[j] > t) j--;
+        }
+        if (d[left] == t) {
+            tmp = d[left]; d[left] = d[j]; d[j] = tmp;
+        } else {
+            j++;
+            tmp = d[j]; d[j] = d[right]; d[right] = tmp;
+        }
+
+        if (j <= k) left = j + 1;
+        if (k <= j) right = j - 1;
+    }
+}
+
+/**
+ * @brief Partially reorder so d[k] holds the k-th smallest of d[lo..hi]
+ *
+ * Expected O(n) against the O(n log n) full sort it replaces, which
+ * dominated summary time on multi-million-sample runs. Afterwards
+ * everything left of k is <= d[k] and everything right of k is >= d[k].
+ */
+static void select_nth(uint64_t *d, size_t lo, size_t hi, size_t k) {
+    fr_select(d, (int64_t)lo, (int64_t)hi, (int64_t)k);
+}
+
+/**
+ * @brief Percentile by partial selection with linear interpolation
+ *
+ * Matches pqc_stats_percentile()'s interpolation definition exactly but
+ * extracts only the order statistics it needs: one selection plus, when
+ * the rank falls between two elements, a min-scan of the right partition
+ * for the next order statistic.
+ *
+ * `from` is an already-settled selection index (everything left of it is
+ * <= everything right), letting ascending-percentile callers shrink each
+ * successive selection to the right partition of the previous one. Pass
+ * 0 when nothing is settled. Returns the rank it settled through *out_at
+ * (may be NULL).
+ */
+static double percentile_select(uint64_t *data, size_t n, double percentile,
+                                size_t from, size_t *out_at) {
+    if (out_at != NULL) {
+        *out_at = from;
+    }
+    if (n == 1) {
+        return (double)data[0];
+    }
+
+    double rank = (percentile / 100.0) * (double)(n - 1);
+    size_t lower_index = (size_t)floor(rank);
+    double fraction = rank - (double)lower_index;
+
+    if (lower_index > from) {
+        select_nth(data, from, n - 1, lower_index);
+    } else {
+        select_nth(data, 0, n - 1, lower_index);
+    }
+    if (out_at != NULL) {
+        *out_at = lower_index;
+    }
+    double lower_value = (double)data[lower_index];
+
+    if (fraction == 0.0 || lower_index + 1 >= n) {
+        return lower_value;
+    }
+
+    uint64_t upper = data[lower_index + 1];
+    for (size_t i = lower_index + 2; i < n; i++) {
+        if (data[i] < upper) {
+            upper = data[i];
+        }
+    }
+
+    return lower_value + fraction * ((double)upper - lower_value);
+}
+
+// ============================================================================
+// Streaming Statistics (Welford + P-squared)
+// ============================================================================
+
+/**
+ * @brief Initialize a P² estimator for quantile p
+ */
+static void p2_init(pqc_p2_quantile_t *est, double p) {
+    memset(est, 0, sizeof(*est));
+    est->p = p;
+
+    // Desired position increments per observation
+    est->dn[0] = 0.0;
+    est->dn[1] = p / 2.0;
+    est->dn[2] = p;
+    est->dn[3] = (1.0 + p) / 2.0;
+    est->dn[4] = 1.0;
+}
+
+/**
+ * @brief Piecewise-parabolic (P²) marker height adjustment
+ */
+static double p2_parabolic(const pqc_p2_quantile_t *est, int i, double d) {
+    return est->q[i] +
+           d / (est->n[i + 1] - est->n[i - 1]) *
+           ((est->n[i] - est->n[i - 1] + d) * (est->q[i + 1] - est->q[i]) /
+                (est->n[i + 1] - est->n[i]) +
+            (est->n[i + 1] - est->n[i] - d) * (est->q[i] - est->q[i - 1]) /
+                (est->n[i] - est->n[i - 1]));
+}
+
+/**
+ * @brief Linear marker height adjustment (fallback when parabolic overshoots)
+ */
+static double p2_linear(const pqc_p2_quantile_t *est, int i, int d) {
+    return est->q[i] +
+           d * (est->q[i + d] - est->q[i]) / (est->n[i + d] - est->n[i]);
+}
+
+/**
+ * @brief Feed one observation into a P² estimator
+ */
+static void p2_update(pqc_p2_quantile_t *est, double value) {
+    // First five observations: collect and keep sorted
+    if (est->count < 5) {
+        est->q[est->count] = value;
+        est->count++;
+
+        if (est->count == 5) {
+            // Sort initial marker heights
+            for (int i = 0; i < 4; i++) {
+                for (int j = i + 1; j < 5; j++) {
+                    if (est->q[j] < est->q[i]) {
+                        double tmp = est->q[i];
+                        est->q[i] = est->q[j];
+                        est->q[j] = tmp;
+                    }
+                }
+            }
+
+            for (int i = 0; i < 5; i++) {
+                est->n[i] = (double)(i + 1);
+            }
+
+            est->np[0] = 1.0;
+            est->np[1] = 1.0 + 2.0 * est->p;
+            est->np[2] = 1.0 + 4.0 * est->p;
+            est->np[3] = 3.0 + 2.0 * est->p;
+            est->np[4] = 5.0;
+        }
+        return;
+    }
+
+    // Find the cell containing the new observation, updating extremes
+    int k;
+    if (value < est->q[0]) {
+        est->q[0] = value;
+        k = 0;
+    } else if (value < est->q[1]) {
+        k = 0;
+    } else if (value < est->q[2]) {
+        k = 1;
+    } else if (value < est->q[3]) {
+        k = 2;
+    } else if (value <= est->q[4]) {
+        k = 3;
+    } else {
+        est->q[4] = value;
+        k = 3;
+    }
+
+    // Shift marker positions above the cell
+    for (int i = k + 1; i < 5; i++) {
+        est->n[i] += 1.0;
+    }
+    for (int i = 0; i < 5; i++) {
+        est->np[i] += est->dn[i];
+    }
+
+    // Adjust interior marker heights if they drifted from desired positions
+    for (int i = 1; i < 4; i++) {
+        double d = est->np[i] - est->n[i];
+
+        if ((d >= 1.0 && est->n[i + 1] - est->n[i] > 1.0) ||
+            (d <= -1.0 && est->n[i - 1] - est->n[i] < -1.0)) {
+            int sign = (d >= 0.0) ? 1 : -1;
+
+            double candidate = p2_parabolic(est, i, (double)sign);
+            if (est->q[i - 1] < candidate && candidate < est->q[i + 1]) {
+                est->q[i] = candidate;
+            } else {
+                est->q[i] = p2_linear(est, i, sign);
+            }
+
+            est->n[i] += (double)sign;
+        }
+    }
+
+    est->count++;
+}
+
+/**
+ * @brief Current estimate of a P² estimator
+ */
+static double p2_result(const pqc_p2_quantile_t *est) {
+    if (est->count == 0) {
+        return 0.0;
+    }
+
+    // Too few observations for the marker invariant: use the sorted prefix
+    if (est->count < 5) {
+        double sorted[5];
+        memcpy(sorted, est->q, est->count * sizeof(double));
+        for (size_t i = 0; i + 1 < est->count; i++) {
+            for (size_t j = i + 1; j < est->count; j++) {
+                if (sorted[j] < sorted[i]) {
+                    double tmp = sorted[i];
+                    sorted[i] = sorted[j];
+                    sorted[j] = tmp;
+                }
+            }
+        }
+        size_t idx = (size_t)(est->p * (double)(est->count - 1));
+        return sorted[idx];
+    }
+
+    return est->q[2];
+}
+
+void pqc_stream_stats_init(pqc_stream_stats_t *stream) {
+    if (stream == NULL) {
+        return;
+    }
+
+    memset(stream, 0, sizeof(*stream));
+    stream->min = UINT64_MAX;
+
+    p2_init(&stream->median, 0.50);
+    p2_init(&stream->p95, 0.95);
+    p2_init(&stream->p99, 0.99);
+}
+
+void pqc_stream_stats_update(pqc_stream_stats_t *stream, uint64_t value) {
+    if (stream == NULL) {
+        return;
+    }
+
+    stream->count++;
+
+    // Welford's online mean/variance update
+    double delta = (double)value - stream->mean;
+    stream->mean += delta / (double)stream->count;
+    stream->m2 += delta * ((double)value - stream->mean);
+
+    if (value < stream->min) {
+        stream->min = value;
+    }
+    if (value > stream->max) {
+        stream->max = value;
+    }
+
+    p2_update(&stream->median, (double)value);
+    p2_update(&stream->p95, (double)value);
+    p2_update(&stream->p99, (double)value);
+}
+
+pqc_stats_t pqc_stream_stats_finalize(const pqc_stream_stats_t *stream) {
+    pqc_stats_t stats = {0};
+
+    if (stream == NULL || stream->count == 0) {
+        LOG_WARN("pqc_stream_stats_finalize: empty stream");
+        return stats;
+    }
+
+    stats.n_samples = stream->count;
+    stats.mean = stream->mean;
+    stats.min = stream->min;
+    stats.max = stream->max;
+
+    // Sample standard deviation (n-1), matching pqc_stats_stddev
+    if (stream->count > 1) {
+        stats.stddev = sqrt(stream->m2 / (double)(stream->count - 1));
+    }
+
+    stats.median = p2_result(&stream->median);
+    stats.p95 = p2_result(&stream->p95);
+    stats.p99 = p2_result(&stream->p99);
+
+    return stats;
+}
+
 // ============================================================================
 // Statistical Functions
 // ============================================================================
@@ -51,25 +517,19 @@ pqc_stats_t pqc_stats_calculate(uint64_t *data, size_t n) {
     }
     
     stats.n_samples = n;
-    
-    // Calculate mean first (needed for stddev)
-    stats.mean = pqc_stats_mean(data, n);
-    
-    // Calculate min/max
-    stats.min = pqc_stats_min(data, n);
-    stats.max = pqc_stats_max(data, n);
-    
-    // Calculate standard deviation
-    stats.stddev = pqc_stats_stddev(data, n, stats.mean);
-    
-    // Sort for percentile calculations (modifies array!)
-    sort_array(data, n);
-    
-    // Calculate percentiles
-    stats.median = pqc_stats_percentile(data, n, 50.0);
-    stats.p95 = pqc_stats_percentile(data, n, 95.0);
-    stats.p99 = pqc_stats_percentile(data, n, 99.0);
-    
+
+    // One fused pass for the moments and extremes, then selection for
+    // the percentiles (partially reorders the array!)
+    stats_fused_pass(data, n, &stats.min, &stats.max,
+                     &stats.mean, &stats.stddev);
+
+    // Ascending order so each selection only searches the right
+    // partition left behind by the previous one
+    size_t settled = 0;
+    stats.median = percentile_select(data, n, 50.0, settled, &settled);
+    stats.p95 = percentile_select(data, n, 95.0, settled, &settled);
+    stats.p99 = percentile_select(data, n, 99.0, settled, &settled);
+
     return stats;
 }
 
@@ -91,16 +551,9 @@ double pqc_stats_median(uint64_t *data, size_t n) {
         return 0.0;
     }
     
-    // Ensure array is sorted
-    sort_array(data, n);
-    
-    if (n % 2 == 0) {
-        // Even number of elements: average of two middle values
-        return ((double)data[n/2 - 1] + (double)data[n/2]) / 2.0;
-    } else {
-        // Odd number of elements: middle value
-        return (double)data[n/2];
-    }
+    // Interpolated rank 0.5*(n-1): the middle value for odd n, the
+    // average of the two middle values for even n
+    return percentile_select(data, n, 50.0, 0, NULL);
 }
 
 double pqc_stats_stddev(const uint64_t *data, size_t n, double mean) {
@@ -133,29 +586,8 @@ double pqc_stats_percentile(uint64_t *data, size_t n, double percentile) {
         LOG_WARN("Invalid percentile: %.2f (must be 0-100)", percentile);
         return 0.0;
     }
-    
-    // Ensure array is sorted
-    sort_array(data, n);
-    
-    if (n == 1) {
-        return (double)data[0];
-    }
-    
-    // Linear interpolation method
-    double rank = (percentile / 100.0) * (double)(n - 1);
-    size_t lower_index = (size_t)floor(rank);
-    size_t upper_index = (size_t)ceil(rank);
-    
-    if (lower_index == upper_index) {
-        return (double)data[lower_index];
-    }
-    
-    // Interpolate between lower and upper values
-    double fraction = rank - (double)lower_index;
-    double lower_value = (double)data[lower_index];
-    double upper_value = (double)data[upper_index];
-    
-    return lower_value + fraction * (upper_value - lower_value);
+
+    return percentile_select(data, n, percentile, 0, NULL);
 }
 
 uint64_t pqc_stats_min(const uint64_t *data, size_t n) {
@@ -237,6 +669,98 @@ size_t pqc_stats_remove_outliers(uint64_t *data, size_t n, double multiplier) {
     return write_idx;
 }
 
+// ============================================================================
+// Two-Sample Comparison
+// ============================================================================
+
+/**
+ * @brief Tagged value for the pooled ranking pass
+ */
+typedef struct {
+    uint64_t value;
+    uint8_t  group;   // 0 = first sample, 1 = second sample
+} ranked_value_t;
+
+/**
+ * @brief Comparison function for qsort over tagged values
+ */
+static int compare_ranked(const void *a, const void *b) {
+    uint64_t val_a = ((const ranked_value_t *)a)->value;
+    uint64_t val_b = ((const ranked_value_t *)b)->value;
+
+    if (val_a < val_b) return -1;
+    if (val_a > val_b) return 1;
+    return 0;
+}
+
+double pqc_stats_mann_whitney_z(const uint64_t *a, size_t na,
+                                const uint64_t *b, size_t nb) {
+    if (a == NULL || b == NULL || na < 2 || nb < 2) {
+        return 0.0;
+    }
+
+    size_t n = na + nb;
+    ranked_value_t *pooled = (ranked_value_t*)malloc(n * sizeof(ranked_value_t));
+    if (pooled == NULL) {
+        LOG_ERROR("Failed to allocate pooled rank array");
+        return 0.0;
+    }
+
+    for (size_t i = 0; i < na; i++) {
+        pooled[i].value = a[i];
+        pooled[i].group = 0;
+    }
+    for (size_t i = 0; i < nb; i++) {
+        pooled[na + i].value = b[i];
+        pooled[na + i].group = 1;
+    }
+
+    qsort(pooled, n, sizeof(ranked_value_t), compare_ranked);
+
+    // Assign average ranks to tied runs; timer quantization makes ties
+    // common, so the variance needs the sum(t^3 - t) tie correction
+    double rank_sum_b = 0.0;
+    double tie_correction = 0.0;
+    size_t i = 0;
+
+    while (i < n) {
+        size_t j = i;
+        while (j < n && pooled[j].value == pooled[i].value) {
+            j++;
+        }
+
+        size_t t = j - i;
+        double avg_rank = ((double)i + (double)j + 1.0) / 2.0;  // 1-based
+
+        for (size_t k = i; k < j; k++) {
+            if (pooled[k].group == 1) {
+                rank_sum_b += avg_rank;
+            }
+        }
+
+        if (t > 1) {
+            tie_correction += (double)t * (double)t * (double)t - (double)t;
+        }
+
+        i = j;
+    }
+
+    free(pooled);
+
+    double u_b = rank_sum_b - (double)nb * ((double)nb + 1.0) / 2.0;
+    double mu = (double)na * (double)nb / 2.0;
+    double variance = (double)na * (double)nb / 12.0 *
+                      (((double)n + 1.0) -
+                       tie_correction / ((double)n * ((double)n - 1.0)));
+
+    if (variance <= 0.0) {
+        // All values tied: no evidence of a shift either way
+        return 0.0;
+    }
+
+    return (u_b - mu) / sqrt(variance);
+}
+
 // ============================================================================
 // Utility Functions
 // ============================================================================
@@ -32,19 +32,82 @@ typedef struct {
     size_t   n_samples;     ///< Number of samples
 } pqc_stats_t;
 
+/**
+ * @brief State of a single P-squared (P²) streaming quantile estimator
+ *
+ * Estimates one quantile online with five markers and O(1) memory,
+ * without retaining or sorting the sample array (Jain & Chlamtac, 1985).
+ */
+typedef struct {
+    double p;           ///< Target quantile in (0, 1)
+    double q[5];        ///< Marker heights
+    double n[5];        ///< Marker positions
+    double np[5];       ///< Desired marker positions
+    double dn[5];       ///< Desired position increments
+    size_t count;       ///< Observations seen so far
+} pqc_p2_quantile_t;
+
+/**
+ * @brief Online statistics accumulator for sample-by-sample feeding
+ *
+ * Combines Welford's running mean/variance with P² estimators for the
+ * median, p95 and p99, so multi-million-sample runs need O(1) memory
+ * instead of retaining the full sample array.
+ */
+typedef struct {
+    size_t   count;               ///< Number of samples accumulated
+    double   mean;                ///< Running mean (Welford)
+    double   m2;                  ///< Running sum of squared deviations (Welford)
+    uint64_t min;                 ///< Minimum value seen
+    uint64_t max;                 ///< Maximum value seen
+    pqc_p2_quantile_t median;     ///< Streaming median estimator
+    pqc_p2_quantile_t p95;        ///< Streaming 95th percentile estimator
+    pqc_p2_quantile_t p99;        ///< Streaming 99th percentile estimator
+} pqc_stream_stats_t;
+
 // ============================================================================
 // Statistical Functions
 // ============================================================================
 
+/**
+ * @brief Initialize a streaming statistics accumulator
+ * @param stream Accumulator to initialize
+ */
+void pqc_stream_stats_init(pqc_stream_stats_t *stream);
+
+/**
+ * @brief Feed one sample into a streaming accumulator
+ * @param stream Accumulator to update
+ * @param value Sample value in nanoseconds
+ *
+ * O(1) time and memory per sample; no allocation.
+ */
+void pqc_stream_stats_update(pqc_stream_stats_t *stream, uint64_t value);
+
+/**
+ * @brief Produce a statistical summary from a streaming accumulator
+ * @param stream Accumulator to summarize
+ * @return Statistical summary (percentiles are P² estimates)
+ *
+ * Returns a zeroed structure if stream is NULL or empty. With fewer than
+ * five samples the quantile estimates fall back to the extremes seen.
+ */
+pqc_stats_t pqc_stream_stats_finalize(const pqc_stream_stats_t *stream);
+
 /**
  * @brief Calculate comprehensive statistics from array of measurements
  * @param data Array of timing measurements in nanoseconds
  * @param n Number of measurements
  * @return Statistical summary
- * 
- * Note: This function sorts the input array in-place for percentile calculations.
- * If you need to preserve the original order, pass a copy.
- * 
+ *
+ * Single fused pass (vectorized where available) for mean/min/max/stddev,
+ * then quickselect for the percentiles, so multi-million-sample summaries
+ * cost O(n) instead of a full sort.
+ *
+ * Note: This function partially reorders the input array in-place for
+ * percentile selection. If you need to preserve the original order, pass
+ * a copy.
+ *
  * Returns zeroed structure if data is NULL or n == 0.
  */
 pqc_stats_t pqc_stats_calculate(uint64_t *data, size_t n);
@@ -59,11 +122,11 @@ double pqc_stats_mean(const uint64_t *data, size_t n);
 
 /**
  * @brief Calculate median (50th percentile)
- * @param data Array of values (will be sorted in-place)
+ * @param data Array of values (will be partially reordered in-place)
  * @param n Number of values
  * @return Median value, or 0.0 if n == 0
- * 
- * Warning: Modifies the input array by sorting it.
+ *
+ * Warning: Modifies the input array (partial reordering by selection).
  */
 double pqc_stats_median(uint64_t *data, size_t n);
 
@@ -80,13 +143,14 @@ double pqc_stats_stddev(const uint64_t *data, size_t n, double mean);
 
 /**
  * @brief Calculate arbitrary percentile
- * @param data Array of values (will be sorted in-place)
+ * @param data Array of values (will be partially reordered in-place)
  * @param n Number of values
  * @param percentile Percentile to calculate (0.0 to 100.0)
  * @return Percentile value, or 0.0 if n == 0 or percentile is invalid
- * 
- * Uses linear interpolation between nearest values.
- * Warning: Modifies the input array by sorting it.
+ *
+ * Uses linear interpolation between nearest values, extracted by
+ * quickselect rather than a full sort.
+ * Warning: Modifies the input array (partial reordering by selection).
  */
 double pqc_stats_percentile(uint64_t *data, size_t n, double percentile);
 
@@ -123,6 +187,30 @@ uint64_t pqc_stats_max(const uint64_t *data, size_t n);
  */
 size_t pqc_stats_remove_outliers(uint64_t *data, size_t n, double multiplier);
 
+// ============================================================================
+// Two-Sample Comparison
+// ============================================================================
+
+/**
+ * @brief Mann-Whitney U z-score comparing two independent samples
+ * @param a First sample (e.g., baseline timings)
+ * @param na Number of values in a
+ * @param b Second sample (e.g., fresh timings)
+ * @param nb Number of values in b
+ * @return Standard-normal z-score, positive when b tends to be larger than a
+ *
+ * Rank-based test for a location shift between two samples, using the
+ * normal approximation with average ranks and tie correction (timing
+ * data is heavily tied after timer quantization). Valid for the sample
+ * counts benchmarks produce (hundreds and up); makes no distributional
+ * assumption, so it is robust to the skew of latency data.
+ *
+ * Returns 0.0 on degenerate input (NULL arrays, fewer than 2 values on
+ * either side, or all values tied). Does not modify the input arrays.
+ */
+double pqc_stats_mann_whitney_z(const uint64_t *a, size_t na,
+                                const uint64_t *b, size_t nb);
+
 // ============================================================================
 // Utility Functions
 // ============================================================================
@@ -10,31 +10,180 @@
 #include <errno.h>
 #include <string.h>
 
+// ============================================================================
+// Backend State
+// ============================================================================
+
+static pqc_timing_backend_t g_timing_backend = PQC_TIMING_BACKEND_MONOTONIC;
+static double g_ns_per_cycle = 0.0;
+
+// ============================================================================
+// Cycle Counter Access (per architecture)
+// ============================================================================
+
+/**
+ * @brief Whether a raw cycle counter is readable on this build target
+ */
+#if defined(__x86_64__) || defined(__amd64__) || defined(__aarch64__) || \
+    (defined(__riscv) && (__riscv_xlen == 64))
+#define PQC_HAVE_CYCLE_COUNTER 1
+#else
+#define PQC_HAVE_CYCLE_COUNTER 0
+#endif
+
+/**
+ * @brief Read the raw CPU cycle counter
+ * @return Current cycle count, or 0 if unsupported
+ *
+ * Uses RDTSC on x86_64, the virtual counter CNTVCT_EL0 on arm64 (readable
+ * at EL0 and constant-rate), and rdcycle on riscv64.
+ */
+static inline uint64_t read_cycle_counter(void) {
+#if defined(__x86_64__) || defined(__amd64__)
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t val;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(val));
+    return val;
+#elif defined(__riscv) && (__riscv_xlen == 64)
+    uint64_t val;
+    __asm__ volatile("rdcycle %0" : "=r"(val));
+    return val;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Calibrate the cycles-to-nanoseconds ratio against CLOCK_MONOTONIC
+ * @return 0 on success, -1 if the counter did not advance
+ *
+ * Spins for ~50ms bracketed by monotonic clock reads and divides the
+ * elapsed nanoseconds by the elapsed cycles.
+ */
+static int calibrate_cycle_counter(void) {
+    struct timespec t0, t1;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &t0) != 0) {
+        LOG_ERROR("clock_gettime failed during calibration: %s", strerror(errno));
+        return -1;
+    }
+    uint64_t c0 = read_cycle_counter();
+
+    // Busy-wait ~50ms; sleeping would stop TSC-like counters on some cores
+    const int64_t calibration_ns = 50 * 1000000LL;
+    int64_t elapsed_ns = 0;
+    do {
+        if (clock_gettime(CLOCK_MONOTONIC, &t1) != 0) {
+            LOG_ERROR("clock_gettime failed during calibration: %s", strerror(errno));
+            return -1;
+        }
+        elapsed_ns = (t1.tv_sec - t0.tv_sec) * 1000000000LL +
+                     (t1.tv_nsec - t0.tv_nsec);
+    } while (elapsed_ns < calibration_ns);
+
+    uint64_t c1 = read_cycle_counter();
+
+    if (c1 <= c0) {
+        LOG_ERROR("Cycle counter did not advance during calibration");
+        return -1;
+    }
+
+    g_ns_per_cycle = (double)elapsed_ns / (double)(c1 - c0);
+
+    LOG_INFO("Cycle counter calibrated: %.4f ns/cycle (%.2f MHz)",
+             g_ns_per_cycle, 1000.0 / g_ns_per_cycle);
+
+    return 0;
+}
+
+// ============================================================================
+// Backend Selection
+// ============================================================================
+
+int pqc_timing_set_backend(pqc_timing_backend_t backend) {
+    if (backend == PQC_TIMING_BACKEND_MONOTONIC) {
+        g_timing_backend = PQC_TIMING_BACKEND_MONOTONIC;
+        return 0;
+    }
+
+#if PQC_HAVE_CYCLE_COUNTER
+    // Calibrate once; re-selecting the backend reuses the existing ratio
+    if (g_ns_per_cycle == 0.0) {
+        if (calibrate_cycle_counter() != 0) {
+            LOG_WARN("Cycle counter calibration failed, "
+                     "keeping monotonic backend");
+            return -1;
+        }
+    }
+
+    g_timing_backend = PQC_TIMING_BACKEND_CYCLES;
+    LOG_DEBUG("Timing backend: %s", pqc_timing_backend_string(backend));
+    return 0;
+#else
+    LOG_WARN("Cycle counter not available on this platform, "
+             "keeping monotonic backend");
+    return -1;
+#endif
+}
+
+pqc_timing_backend_t pqc_timing_get_backend(void) {
+    return g_timing_backend;
+}
+
+double pqc_timing_ns_per_cycle(void) {
+    return g_ns_per_cycle;
+}
+
+const char* pqc_timing_backend_string(pqc_timing_backend_t backend) {
+    switch (backend) {
+        case PQC_TIMING_BACKEND_MONOTONIC:
+            return "monotonic";
+        case PQC_TIMING_BACKEND_CYCLES:
+            return "cycles";
+        default:
+            return "unknown";
+    }
+}
+
 // ============================================================================
 // Core Timing Functions
 // ============================================================================
 
 pqc_timestamp_t pqc_timestamp_now(void) {
     pqc_timestamp_t timestamp;
-    
+
+    if (g_timing_backend == PQC_TIMING_BACKEND_CYCLES) {
+        timestamp.cycles = read_cycle_counter();
+        return timestamp;
+    }
+
     if (clock_gettime(CLOCK_MONOTONIC, &timestamp.ts) != 0) {
         // Log error but continue with zeroed timestamp
         LOG_ERROR("clock_gettime failed: %s", strerror(errno));
         timestamp.ts.tv_sec = 0;
         timestamp.ts.tv_nsec = 0;
     }
-    
+
     return timestamp;
 }
 
 pqc_time_ns_t pqc_timestamp_diff(pqc_timestamp_t start, pqc_timestamp_t end) {
+    if (g_timing_backend == PQC_TIMING_BACKEND_CYCLES) {
+        // Convert elapsed cycles to ns with the calibrated ratio so all
+        // downstream consumers keep working in nanoseconds
+        return (pqc_time_ns_t)((double)(end.cycles - start.cycles) * g_ns_per_cycle);
+    }
+
     // Calculate difference in seconds and nanoseconds
     int64_t sec_diff = end.ts.tv_sec - start.ts.tv_sec;
     int64_t nsec_diff = end.ts.tv_nsec - start.ts.tv_nsec;
-    
+
     // Convert to total nanoseconds
     pqc_time_ns_t total_ns = (pqc_time_ns_t)(sec_diff * 1000000000LL + nsec_diff);
-    
+
     return total_ns;
 }
 
@@ -19,12 +19,28 @@
 // ============================================================================
 
 /**
- * @brief Timestamp structure using CLOCK_MONOTONIC
- * 
- * Uses monotonic clock to avoid issues with system time adjustments.
+ * @brief Timing backend selection
+ *
+ * The monotonic backend uses clock_gettime(CLOCK_MONOTONIC), which is
+ * portable but costs a vDSO call per sample with ~20-40ns jitter. The
+ * cycle-counter backend reads the raw CPU cycle counter (RDTSC on x86_64,
+ * CNTVCT_EL0 on arm64, rdcycle on riscv64) and converts to nanoseconds
+ * using a calibrated ratio, so downstream consumers keep working in ns.
+ */
+typedef enum {
+    PQC_TIMING_BACKEND_MONOTONIC,  ///< clock_gettime(CLOCK_MONOTONIC) (default)
+    PQC_TIMING_BACKEND_CYCLES      ///< Raw CPU cycle counter, calibrated to ns
+} pqc_timing_backend_t;
+
+/**
+ * @brief Timestamp structure
+ *
+ * Holds either a monotonic timespec or a raw cycle count, depending on
+ * the active timing backend.
  */
 typedef struct {
-    struct timespec ts;  ///< Internal timespec structure
+    struct timespec ts;  ///< Monotonic clock reading (monotonic backend)
+    uint64_t cycles;     ///< Raw cycle counter reading (cycle backend)
 } pqc_timestamp_t;
 
 /**
@@ -32,6 +48,43 @@ typedef struct {
  */
 typedef uint64_t pqc_time_ns_t;
 
+// ============================================================================
+// Backend Selection
+// ============================================================================
+
+/**
+ * @brief Select the timing backend
+ * @param backend Backend to use for subsequent timestamps
+ * @return 0 on success, -1 if the backend is unavailable on this platform
+ *
+ * Selecting the cycle backend calibrates the cycles-to-nanoseconds ratio
+ * against CLOCK_MONOTONIC (one ~50ms calibration run, performed once).
+ * If the cycle counter is not readable on this platform, the monotonic
+ * backend stays active and -1 is returned.
+ *
+ * Not thread-safe: select the backend before starting measurement threads.
+ */
+int pqc_timing_set_backend(pqc_timing_backend_t backend);
+
+/**
+ * @brief Get the currently active timing backend
+ * @return Active backend
+ */
+pqc_timing_backend_t pqc_timing_get_backend(void);
+
+/**
+ * @brief Get the calibrated nanoseconds-per-cycle ratio
+ * @return Nanoseconds per cycle, or 0.0 if the cycle backend was never calibrated
+ */
+double pqc_timing_ns_per_cycle(void);
+
+/**
+ * @brief Convert backend enum to string
+ * @param backend Timing backend
+ * @return Static string describing the backend
+ */
+const char* pqc_timing_backend_string(pqc_timing_backend_t backend);
+
 // ============================================================================
 // Timing Functions
 // ============================================================================
@@ -39,8 +92,8 @@ typedef uint64_t pqc_time_ns_t;
 /**
  * @brief Get current timestamp
  * @return Current timestamp
- * 
- * Uses CLOCK_MONOTONIC for reliable, high-resolution timing.
+ *
+ * Reads the active timing backend (CLOCK_MONOTONIC by default).
  */
 pqc_timestamp_t pqc_timestamp_now(void);
 